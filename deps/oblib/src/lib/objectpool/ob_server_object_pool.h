@@ -51,8 +51,8 @@ struct ObPoolArenaHead
   int32_t return_cnt; // Number of calls
   int32_t miss_cnt; // Number of direct allocations
   int32_t miss_return_cnt; // Number of returns directly allocated
-  int16_t free_num;  // Number of caches
-  int16_t reserved1;
+  int32_t free_num;  // Number of caches
+  int32_t reserved1;
   int64_t last_borrow_ts; // Time of last visit
   int64_t last_return_ts; // Time of last visit
   int64_t last_miss_ts; // The time of the last direct allocation
@@ -227,7 +227,7 @@ public:
         Meta *cmeta = reinterpret_cast<Meta*>(p);
         cmeta->next = NULL;
         cmeta->arena_id = -1;
-        cmeta->magic = 0xFEDCFEDC01230123;
+        cmeta->magic = MISS_ALLOC_MAGIC;
         ctx = PTR_META2OBJ(p);
         new (ctx) T();
       }
@@ -245,23 +245,53 @@ public:
         x->reset();
         ObPoolArenaHead &arena = arena_[aid];
         int64_t cur_ts = OB_TSC_TIMESTAMP.current_time();
+        bool cached = true;
         { // Enter the critical area of the arena, the timestamp is obtained outside the lock, and minimize the length of the critical area
           ObLatchWGuard lock_guard(arena.lock, ObLatchIds::SERVER_OBJECT_POOL_ARENA_LOCK);
-          cmeta->next = static_cast<Meta*>(arena.next);
-          arena.next = static_cast<void*>(cmeta);
-          arena.return_cnt++;
-          arena.free_num++;
-          arena.last_return_ts = cur_ts;
+          if (MISS_ALLOC_MAGIC == cmeta->magic && arena.free_num >= cnt_per_arena_) {
+            // an adopted miss object is freed when the arena is full, preallocated ones always
+            // go back as they belong to buf_
+            arena.miss_return_cnt++;
+            arena.last_miss_return_ts = cur_ts;
+            cached = false;
+          } else {
+            cmeta->next = static_cast<Meta*>(arena.next);
+            arena.next = static_cast<void*>(cmeta);
+            arena.return_cnt++;
+            arena.free_num++;
+            arena.last_return_ts = cur_ts;
+          }
+        }
+        if (!cached) {
+          x->~T();
+          ob_free(cmeta);
         }
       } else {
-        x->~T();
-        ob_free(cmeta);
-        ObPoolArenaHead &arena = arena_[-aid];
+        // The object was allocated directly because the arena was empty. Keep it in the arena
+        // of the returning thread if there is room, so that the next borrow on this thread
+        // hits the cache instead of allocating and constructing a new object. An adopted object
+        // keeps MISS_ALLOC_MAGIC and is freed whenever it is returned to a full arena, so the
+        // adopted objects cached in an arena never exceed cnt_per_arena_.
+        const int64_t cur_aid = get_itid() % arena_.size();
+        ObPoolArenaHead &arena = arena_[cur_aid];
         int64_t cur_ts = OB_TSC_TIMESTAMP.current_time();
+        bool adopted = false;
+        x->reset();
         { // Enter the critical area of the arena, the timestamp is obtained outside the lock, and minimize the length of the critical area
           ObLatchWGuard lock_guard(arena.lock, ObLatchIds::SERVER_OBJECT_POOL_ARENA_LOCK);
           arena.miss_return_cnt++;
           arena.last_miss_return_ts = cur_ts;
+          if (arena.free_num < cnt_per_arena_) {
+            cmeta->arena_id = cur_aid;
+            cmeta->next = static_cast<Meta*>(arena.next);
+            arena.next = static_cast<void*>(cmeta);
+            arena.free_num++;
+            adopted = true;
+          }
+        }
+        if (!adopted) {
+          x->~T();
+          ob_free(cmeta);
         }
       }
     }
@@ -294,7 +324,7 @@ private:
           Meta *cmeta = reinterpret_cast<Meta*>(p);
           cmeta->next = pmeta;
           cmeta->arena_id = i;
-          cmeta->magic = 0xFEDCFEDC01240124;
+          cmeta->magic = PREALLOC_MAGIC;
           pmeta = cmeta;
           new (p + sizeof(Meta)) T();
           p += item_size_;
@@ -302,7 +332,7 @@ private:
         ObPoolArenaHead &arena = arena_[i];
         arena.reset();
         arena.next = static_cast<void*>(pmeta);
-        arena.free_num = static_cast<int16_t>(cnt_per_arena_);
+        arena.free_num = static_cast<int32_t>(cnt_per_arena_);
       }
       if (OB_FAIL(ObServerObjectPoolRegistry::add(typeid(T).name(), &arena_))) { // Register to the global list, display and print the log in the virtual table
         COMMON_LOG(WARN, "add to pool registry failed, can't be monitored", K(ret), K(typeid(T).name()), KP(this), K(this));
@@ -319,6 +349,8 @@ private:
   }
 
 private:
+  static const int64_t MISS_ALLOC_MAGIC = 0xFEDCFEDC01230123;
+  static const int64_t PREALLOC_MAGIC = 0xFEDCFEDC01240124;
   struct Meta
   {
     Meta * next;
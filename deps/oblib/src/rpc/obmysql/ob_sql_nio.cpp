@@ -289,12 +289,16 @@ private:
   int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
-    while(pos < sz && OB_SUCCESS == ret) {
+    bool would_block = false;
+    while(pos < sz && OB_SUCCESS == ret && !would_block) {
       int64_t wbytes = 0;
       if ((wbytes = write(fd, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
       } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        LOG_INFO("write return EAGAIN");
+        // socket buffer is full on a slow client, leave the rest to EPOLLOUT
+        // instead of spinning the io thread
+        would_block = true;
+        LOG_INFO("write return EAGAIN", K(pos), K(sz));
       } else if (EINTR == errno) {
         // pass
       } else {
@@ -131,11 +131,16 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   bool is_packed = result.get_physical_plan() ? result.get_physical_plan()->is_packed() : false;
   MYSQL_PROTOCOL_TYPE protocol_type = is_ps_protocol ? BINARY : TEXT;
   const common::ColumnsFieldIArray *fields = NULL;
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
+  ObSEArray<ObSMColumnEncoder, 16> column_encoders;
   if (OB_SUCC(ret)) {
     fields = result.get_field_columns();
     if (OB_ISNULL(fields)) {
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("fields is null", K(ret), KP(fields));
+    } else if (!is_packed
+               && OB_FAIL(ObSMUtils::init_column_encoders(*fields, dtc_params, column_encoders))) {
+      LOG_WARN("failed to init column encoders", K(ret));
     }
   }
   while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
@@ -183,12 +188,12 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       }
     }
     if (OB_SUCC(ret)) {
-      const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
       ObSMRow sm(protocol_type, *row, dtc_params,
                          result.get_field_columns(),
                          ctx_.schema_guard_,
                          session_.get_effective_tenant_id());
       sm.set_packed(is_packed);
+      sm.set_column_encoders(column_encoders.get_data(), column_encoders.count());
       OMPKRow rp(sm);
       rp.set_is_packed(is_packed);
       if (OB_FAIL(sender_.response_packet(rp, &result.get_session()))) {
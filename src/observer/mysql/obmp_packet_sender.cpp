@@ -73,7 +73,8 @@ ObMPPacketSender::ObMPPacketSender()
       req_has_wokenup_(true),
       query_receive_ts_(0),
       nio_protocol_(0),
-      conn_(NULL)
+      conn_(NULL),
+      flush_cnt_(0)
 {
 }
 
@@ -102,6 +103,7 @@ void ObMPPacketSender::reset()
   req_has_wokenup_ = true;
   query_receive_ts_ = 0;
   conn_ = NULL;
+  flush_cnt_ = 0;
 }
 
 int ObMPPacketSender::init(rpc::ObRequest *req)
@@ -151,6 +153,7 @@ int ObMPPacketSender::do_init(rpc::ObRequest *req,
     req_has_wokenup_ = req_has_wokenup;
     query_receive_ts_ = query_receive_ts;
     conn_ = conn;
+    flush_cnt_ = 0;
 
     sessid_ = conn->sessid_;
     // init comp_context
@@ -871,6 +874,7 @@ int ObMPPacketSender::flush_buffer(const bool is_last)
             LOG_WARN("write response fail", K(ret));
           } else {
             init_easy_buf(ez_buf_, (char*)(ez_buf_ + 1),  NULL, ez_buf_->end - ez_buf_->pos);
+            grow_ezbuf_for_coalesce();
           }
         }
       }
@@ -884,6 +888,7 @@ int ObMPPacketSender::flush_buffer(const bool is_last)
           LOG_WARN("write response fail", K(ret));
         } else {
           init_easy_buf(ez_buf_, (char*)(ez_buf_ + 1),  NULL, ez_buf_->end - ez_buf_->pos);
+          grow_ezbuf_for_coalesce();
         }
       }
     }
@@ -968,6 +973,35 @@ int ObMPPacketSender::resize_ezbuf(const int64_t size)
   return ret;
 }
 
+// Rows of a big result set are coalesced into a larger buffer after a few flushes,
+// so that each blocking write sends more packets. Only called right after a flush,
+// the buffer holds no data and the caller keeps going with the old one on failure.
+void ObMPPacketSender::grow_ezbuf_for_coalesce()
+{
+  ++flush_cnt_;
+  if (OB_NOT_NULL(ez_buf_) && OB_NOT_NULL(req_)
+      && flush_cnt_ >= COALESCE_FLUSH_THRESHOLD
+      && ez_buf_->pos == ez_buf_->last) {
+    const int64_t cur_size = ez_buf_->end - reinterpret_cast<char *>(ez_buf_);
+    const int64_t new_size = MIN(cur_size * 2, MAX_COALESCE_BUF_SIZE);
+    char *buf = NULL;
+    if (new_size <= cur_size) {
+      // already large enough
+    } else if (OB_ISNULL(buf = (char*)SQL_REQ_OP.alloc_sql_response_buffer(req_, new_size))) {
+      LOG_WARN("failed to alloc coalesce buffer, keep the current one", K(new_size));
+    } else {
+      easy_buf_t *tmp = reinterpret_cast<easy_buf_t *>(buf);
+      init_easy_buf(tmp, reinterpret_cast<char *>(tmp + 1), NULL, new_size - sizeof(easy_buf_t));
+      if (comp_context_.last_pkt_pos_ == ez_buf_->pos) {
+        comp_context_.last_pkt_pos_ = tmp->pos;
+      }
+      SQL_REQ_OP.free_sql_response_buffer(req_, ez_buf_);
+      ez_buf_ = tmp;
+      LOG_DEBUG("grow buffer for result coalescing", K_(flush_cnt), K(cur_size), K(new_size));
+    }
+  }
+}
+
 int ObMPPacketSender::update_transmission_checksum_flag(const ObSQLSessionInfo &session)
 {
   int ret = OB_SUCCESS;
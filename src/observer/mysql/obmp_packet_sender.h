@@ -157,6 +157,10 @@ public:
 private:
   static const int64_t MAX_TRY_STEPS = 8;
   static int64_t TRY_EZ_BUF_SIZES[MAX_TRY_STEPS];
+  // a request flushing this many times is streaming a big result set
+  static const int64_t COALESCE_FLUSH_THRESHOLD = 4;
+  // about the socket send buffer, more bytes per write just block longer on a slow client
+  static const int64_t MAX_COALESCE_BUF_SIZE = 256 * 1024;
 
   int alloc_ezbuf();
   int try_encode_with(obmysql::ObMySQLPacket &pkt,
@@ -168,6 +172,7 @@ private:
                           const bool is_last);
   bool need_flush_buffer() const;
   int resize_ezbuf(const int64_t size);
+  void grow_ezbuf_for_coalesce();
 protected:
   rpc::ObRequest *req_;
   uint8_t seq_;
@@ -180,6 +185,7 @@ protected:
   int64_t query_receive_ts_;
   int nio_protocol_;
   ObSMConnection *conn_;
+  int64_t flush_cnt_;
   common::ObSEArray<obmysql::ObObjKV, 4> extra_info_kvs_;
   common::ObSEArray<obmysql::Obp20Encoder*, 4> extra_info_ecds_;
 private:
@@ -949,6 +949,7 @@ int ObMPStmtExecute::set_session_active(ObSQLSessionInfo &session) const
 }
 
 int ObMPStmtExecute::execute_response(ObSQLSessionInfo &session,
+                                      ParamStore &params,
                                       ObMySQLResultSet &result,
                                       const bool enable_perf_event,
                                       bool &need_response_error,
@@ -1030,7 +1031,7 @@ int ObMPStmtExecute::execute_response(ObSQLSessionInfo &session,
     }
   } else if (OB_FAIL(gctx_.sql_engine_->stmt_execute(stmt_id_,
                                                       stmt_type_,
-                                                      *params_,
+                                                      params,
                                                       ctx_, result,
                                                       false /* is_inner_sql */))) {
     exec_start_timestamp_ = ObTimeUtility::current_time();
@@ -1159,6 +1160,7 @@ int ObMPStmtExecute::do_process(ObSQLSessionInfo &session,
                                         async_resp_used);
           } else {
             ret = execute_response(session,
+                                    *param_store,
                                     result,
                                     enable_perf_event,
                                     need_response_error,
@@ -1511,8 +1513,6 @@ int ObMPStmtExecute::try_batch_multi_stmt_optimization(ObSQLSessionInfo &session
   } else if (!use_plan_cache) {
     LOG_TRACE("not enable the plan_cache", K(use_plan_cache));
     // plan_cache开关没打开
-  } else if (!is_prexecute()) {
-    // 只对二合一协议开启batch优化
   } else if (is_pl_stmt(stmt_type_)) {
     LOG_TRACE("is pl execution, can't do the batch optimization");
   } else if (1 == arraybinding_size_) {
@@ -1589,6 +1589,8 @@ int ObMPStmtExecute::process_execute_stmt(const ObMultiStmtItem &multi_stmt_item
                                                            force_sync_resp,
                                                            async_resp_used, optimization_done))) {
         LOG_WARN("fail to try_batch_multi_stmt_optimization", K(ret));
+        // the old ps protocol responds the whole array once, an error packet ends it
+        need_response_error = !is_prexecute();
       } else if (!optimization_done) {
         ctx_.multi_stmt_item_.set_ps_mode(true);
         ctx_.multi_stmt_item_.set_ab_cnt(0);
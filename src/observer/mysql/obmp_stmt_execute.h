@@ -168,6 +168,7 @@ protected:
                                 const char *bitmap);
   int store_params_value_to_str(ObIAllocator &alloc, sql::ObSQLSessionInfo &session);
   int execute_response(sql::ObSQLSessionInfo &session,
+                        ParamStore &params,
                         ObMySQLResultSet &result,
                         const bool enable_perf_event,
                         bool &need_response_error,
@@ -31,7 +31,9 @@ ObSMRow::ObSMRow(MYSQL_PROTOCOL_TYPE type,
       dtc_params_(dtc_params),
       fields_(fields),
       schema_guard_(schema_guard),
-      tenant_id_(tenant_id)
+      tenant_id_(tenant_id),
+      encoders_(NULL),
+      encoder_cnt_(0)
 {
 }
 
@@ -60,7 +62,9 @@ int ObSMRow::encode_cell(
         : idx;
     const ObObj *cell = &obrow_.cells_[cell_idx];
 
-    if (NULL == fields_) {
+    if (idx < encoder_cnt_ && encoders_[idx].is_valid_for(*cell)) {
+      ret = encoders_[idx].func_(buf, len, *cell, type_, pos, encoders_[idx]);
+    } else if (NULL == fields_) {
       ret = ObSMUtils::cell_str(
           buf, len, *cell, type_, pos, idx, bitmap, dtc_params_, NULL, NULL);
     } else {
@@ -17,6 +17,7 @@
 #include "rpc/obmysql/ob_mysql_row.h"
 #include "common/row/ob_row.h"
 #include "common/ob_field.h"
+#include "observer/mysql/obsm_utils.h"
 
 namespace oceanbase
 {
@@ -44,6 +45,12 @@ public:
           uint64_t tenant = common::OB_INVALID_ID);
 
   virtual ~ObSMRow() {}
+  // encoders resolved once per result set by ObSMUtils::init_column_encoders
+  void set_column_encoders(const ObSMColumnEncoder *encoders, const int64_t count)
+  {
+    encoders_ = encoders;
+    encoder_cnt_ = count;
+  }
 
 protected:
   virtual int64_t get_cells_cnt() const
@@ -62,6 +69,8 @@ private:
   const ColumnsFieldIArray *fields_;
   share::schema::ObSchemaGetterGuard *schema_guard_;
   uint64_t tenant_id_;
+  const ObSMColumnEncoder *encoders_;
+  int64_t encoder_cnt_;
 
   DISALLOW_COPY_AND_ASSIGN(ObSMRow);
 }; // end of class OBMP
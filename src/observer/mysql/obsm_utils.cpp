@@ -299,6 +299,141 @@ int ObSMUtils::cell_str(
   return ret;
 }
 
+static int encode_int_cell(char *buf, const int64_t len, const ObObj &obj,
+                           MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::int_cell_str(buf, len, obj.get_int(), obj.get_type(), false, type, pos,
+                                   enc.zerofill_, enc.zflength_);
+}
+
+static int encode_uint_cell(char *buf, const int64_t len, const ObObj &obj,
+                            MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::int_cell_str(buf, len, obj.get_int(), obj.get_type(), true, type, pos,
+                                   enc.zerofill_, enc.zflength_);
+}
+
+static int encode_float_cell(char *buf, const int64_t len, const ObObj &obj,
+                             MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::float_cell_str(buf, len, obj.get_float(), type, pos, enc.scale_,
+                                     enc.zerofill_, enc.zflength_);
+}
+
+static int encode_double_cell(char *buf, const int64_t len, const ObObj &obj,
+                              MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::double_cell_str(buf, len, obj.get_double(), type, pos, enc.scale_,
+                                      enc.zerofill_, enc.zflength_);
+}
+
+static int encode_number_cell(char *buf, const int64_t len, const ObObj &obj,
+                              MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  UNUSED(type);
+  return ObMySQLUtil::number_cell_str(buf, len, obj.get_number(), pos, enc.scale_,
+                                      enc.zerofill_, enc.zflength_);
+}
+
+static int encode_datetime_cell(char *buf, const int64_t len, const ObObj &obj,
+                                MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::datetime_cell_str(buf, len, obj.get_datetime(), type, pos,
+                                        (obj.is_timestamp() ? enc.tz_info_ : NULL), enc.scale_);
+}
+
+static int encode_date_cell(char *buf, const int64_t len, const ObObj &obj,
+                            MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  UNUSED(enc);
+  return ObMySQLUtil::date_cell_str(buf, len, obj.get_date(), type, pos);
+}
+
+static int encode_time_cell(char *buf, const int64_t len, const ObObj &obj,
+                            MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  return ObMySQLUtil::time_cell_str(buf, len, obj.get_time(), type, pos, enc.scale_);
+}
+
+static int encode_year_cell(char *buf, const int64_t len, const ObObj &obj,
+                            MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  UNUSED(enc);
+  return ObMySQLUtil::year_cell_str(buf, len, obj.get_year(), type, pos);
+}
+
+static int encode_varchar_cell(char *buf, const int64_t len, const ObObj &obj,
+                               MYSQL_PROTOCOL_TYPE type, int64_t &pos, const ObSMColumnEncoder &enc)
+{
+  UNUSED(type);
+  UNUSED(enc);
+  return ObMySQLUtil::varchar_cell_str(buf, len, obj.get_string(), false, pos);
+}
+
+int ObSMUtils::init_column_encoders(const ObIArray<ObField> &fields,
+                                    const ObDataTypeCastParams &dtc_params,
+                                    ObIArray<ObSMColumnEncoder> &encoders)
+{
+  int ret = OB_SUCCESS;
+  encoders.reset();
+  if (OB_FAIL(encoders.reserve(fields.count()))) {
+    OB_LOG(WARN, "failed to reserve column encoders", K(ret), K(fields.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < fields.count(); ++i) {
+    const ObField &field = fields.at(i);
+    ObSMColumnEncoder enc;
+    enc.tc_ = field.type_.get_type_class();
+    enc.scale_ = field.accuracy_.get_scale();
+    enc.precision_ = field.accuracy_.get_precision();
+    enc.zerofill_ = field.flags_ & ZEROFILL_FLAG;
+    enc.zflength_ = field.length_;
+    enc.tz_info_ = dtc_params.tz_info_;
+    // keep the same dispatch as cell_str, type classes need field or schema stay there
+    switch (enc.tc_) {
+      case ObIntTC:
+        enc.func_ = encode_int_cell;
+        break;
+      case ObUIntTC:
+        enc.func_ = encode_uint_cell;
+        break;
+      case ObFloatTC:
+        enc.func_ = encode_float_cell;
+        break;
+      case ObDoubleTC:
+        enc.func_ = encode_double_cell;
+        break;
+      case ObNumberTC:
+        enc.func_ = encode_number_cell;
+        break;
+      case ObDateTimeTC:
+        enc.func_ = encode_datetime_cell;
+        break;
+      case ObDateTC:
+        enc.func_ = encode_date_cell;
+        break;
+      case ObTimeTC:
+        enc.func_ = encode_time_cell;
+        break;
+      case ObYearTC:
+        enc.func_ = encode_year_cell;
+        break;
+      case ObRawTC:
+      case ObTextTC:
+      case ObStringTC:
+      case ObLobTC:
+        enc.func_ = encode_varchar_cell;
+        break;
+      default:
+        enc.func_ = NULL;
+        break;
+    }
+    if (OB_FAIL(encoders.push_back(enc))) {
+      OB_LOG(WARN, "failed to push back column encoder", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
 int get_map(ObObjType ob_type, const ObMySQLTypeMap *&map)
 {
   int ret = OB_SUCCESS;
@@ -21,6 +21,7 @@
 #include "rpc/obmysql/ob_mysql_util.h"
 #include "common/object/ob_object.h"
 #include "common/ob_accuracy.h"
+#include "lib/container/ob_iarray.h"
 
 namespace oceanbase
 {
@@ -34,6 +35,31 @@ class ObSchemaGetterGuard;
 namespace common
 {
 class ObField;
+
+// encode info of a result column resolved once from its field, cells of the column are
+// encoded by func_ without re-reading the field and re-dispatching on type class per row
+struct ObSMColumnEncoder
+{
+  typedef int (*EncodeFunc)(char *buf, const int64_t len, const ObObj &obj,
+                            obmysql::MYSQL_PROTOCOL_TYPE type, int64_t &pos,
+                            const ObSMColumnEncoder &encoder);
+  ObSMColumnEncoder()
+    : func_(NULL), tc_(ObMaxTC), scale_(0), precision_(0), zerofill_(false), zflength_(0),
+      tz_info_(NULL)
+  {}
+  // only usable for cells of the type class of the field, others go to ObSMUtils::cell_str
+  bool is_valid_for(const ObObj &obj) const { return NULL != func_ && obj.get_type_class() == tc_; }
+  TO_STRING_KV(KP_(func), K_(tc), K_(scale), K_(precision), K_(zerofill), K_(zflength));
+
+  EncodeFunc func_; // NULL if the type class is only encoded by ObSMUtils::cell_str
+  ObObjTypeClass tc_;
+  ObScale scale_;
+  ObPrecision precision_;
+  bool zerofill_;
+  int32_t zflength_;
+  const ObTimeZoneInfo *tz_info_;
+};
+
 class ObSMUtils {
 public:
   /**
@@ -57,6 +83,17 @@ public:
       share::schema::ObSchemaGetterGuard *schema_guard = NULL,
       uint64_t tenant_id = common::OB_INVALID_ID);
 
+  /**
+   * 根据结果集的field预先为每一列选出编码函数, 编码结果和cell_str一致。
+   *
+   * @param [in] fields 结果集的field
+   * @param [in] dtc_params session的时区等参数
+   * @param [out] encoders 每一列的编码信息
+   */
+  static int init_column_encoders(const ObIArray<ObField> &fields,
+                                  const ObDataTypeCastParams &dtc_params,
+                                  ObIArray<ObSMColumnEncoder> &encoders);
+
   static bool update_from_bitmap(ObObj &param, const char *bitmap, int64_t field_index);
 
   static bool update_from_bitmap(const char *bitmap, int64_t field_index);
@@ -189,6 +189,7 @@ void oceanbase::observer::init_srv_xlator_for_others(ObSrvRpcXlator *xlator) {
   // DeadLock rpc
   RPC_PROCESSOR(ObDeadLockCollectInfoMessageP, gctx_);
   RPC_PROCESSOR(ObDetectorLCLMessageP, gctx_);
+  RPC_PROCESSOR(ObDetectorLCLBatchMessageP, gctx_);
   RPC_PROCESSOR(ObDeadLockNotifyParentMessageP, gctx_);
 
   // table lock rpc
@@ -58,6 +58,17 @@ using namespace oceanbase::storage;
 using namespace oceanbase::sql::dtl;
 using namespace oceanbase::obrpc;
 
+void ReqQueueTimeHist::record(const int64_t queue_time)
+{
+  int64_t idx = 0;
+  for (int64_t bound = FIRST_BOUND_US;
+       idx < BUCKET_CNT - 1 && queue_time >= bound;
+       bound *= 10) {
+    idx++;
+  }
+  ATOMIC_INC(&cnt_[idx]);
+}
+
 void MultiLevelReqCnt::atomic_inc(const int32_t level)
 {
   if (level < 0 || level >= MAX_REQUEST_LEVEL) {
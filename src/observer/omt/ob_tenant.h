@@ -204,6 +204,36 @@ private:
   volatile uint64_t cnt_[MAX_REQUEST_LEVEL];
 };
 
+// Histogram of the time requests wait in tenant queues. Bucket i counts requests
+// waited less than 1ms * 10^i, the last bucket counts the rest.
+class ReqQueueTimeHist {
+public:
+  static const int64_t BUCKET_CNT = 5;
+  static const int64_t FIRST_BOUND_US = 1000;
+  ReqQueueTimeHist()
+  {
+    for (int i = 0; i < BUCKET_CNT; i++) {
+      cnt_[i] = 0;
+    }
+  }
+  ~ReqQueueTimeHist() {}
+  void record(const int64_t queue_time);
+  uint64_t get_cnt(const int64_t idx) const
+  {
+    return (idx >= 0 && idx < BUCKET_CNT) ? ATOMIC_LOAD(&cnt_[idx]) : 0;
+  }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    for(int i = 0; i < BUCKET_CNT; i++) {
+      common::databuff_printf(buf, buf_len, pos, "hist[%d]=%ld ", i, cnt_[i]);
+    }
+    return pos;
+  }
+private:
+  volatile uint64_t cnt_[BUCKET_CNT];
+};
+
 class ObResourceGroupNode : public common::SpHashNode
 {
 public:
@@ -439,6 +469,7 @@ public:
 
   void add_idle_time(int64_t idle_time);
   void add_worker_time(int64_t req_time);
+  void add_queue_time(int64_t queue_time);
 
   int rdlock(common::ObLDHandle &handle);
   int wrlock(common::ObLDHandle &handle);
@@ -490,6 +521,7 @@ public:
                "large queued", large_req_queue_.size(),
                K_(multi_level_queue),
                K_(recv_level_rpc_cnt),
+               K_(queue_time_hist),
                K_(group_map),
                K_(rpc_stat_info))
 public:
@@ -615,6 +647,7 @@ protected:
   //Create a request queue for each level of nested requests
   ObMultiLevelQueue *multi_level_queue_;
   MultiLevelReqCnt recv_level_rpc_cnt_;
+  ReqQueueTimeHist queue_time_hist_;
 
   //Create a timer queue group for retry requests
   ObRetryQueue retry_queue_;
@@ -716,6 +749,11 @@ inline void ObTenant::add_worker_time(int64_t req_time)
   (void)ATOMIC_FAA(reinterpret_cast<uint64_t *>(&worker_us_), req_time);
 }
 
+inline void ObTenant::add_queue_time(int64_t queue_time)
+{
+  queue_time_hist_.record(queue_time);
+}
+
 inline void ObTenant::pause_it(ObThWorker &w)
 {
   pause_cnt_++;
@@ -435,6 +435,7 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
                 if (OB_LIKELY(nullptr != req)) {
                   req_recv_timestamp = req->get_receive_timestamp(); // Update backtrace printing parameters
                   EVENT_ADD(REQUEST_QUEUE_TIME, wait_end_time - req->get_enqueue_timestamp());
+                  tenant_->add_queue_time(wait_end_time - req->get_enqueue_timestamp());
                   req->set_push_pop_diff(wait_end_time);
                   query_start_time_ = wait_end_time;
                   query_enqueue_time_ = req->get_enqueue_timestamp();
@@ -299,6 +299,10 @@ int ObAllPlanCacheStat::fill_cells(ObPlanCache &plan_cache)
       SET_REF_HANDLE_COL(LC_REF_CACHE_OBJ_STAT_HANDLE);
       break;
     }
+    case SHARED_FRAGMENT_MEM_SAVED: {
+      cells[i].set_int(plan_cache.get_shared_fragment_mem_saved());
+      break;
+    }
     case PLAN_BASELINE: {
        SET_REF_HANDLE_COL(PLAN_BASELINE_HANDLE);
        break;
@@ -123,6 +123,7 @@ private:
     LC_NODE_RD,
     LC_NODE_WR,
     LC_REF_CACHE_OBJ_STAT,
+    SHARED_FRAGMENT_MEM_SAVED,
     PLAN_BASELINE
   };
 private:
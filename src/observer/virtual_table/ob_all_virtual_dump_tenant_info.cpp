@@ -172,6 +172,26 @@ int ObAllVirtualDumpTenantInfo::inner_get_next_row(common::ObNewRow *&row)
           //large_queued
           cells[i].set_int(t.large_req_queue_.size());
           break;
+        case OB_APP_MIN_COLUMN_ID + 32:
+          //queue_time_lt_1ms
+          cells[i].set_int(t.queue_time_hist_.get_cnt(0));
+          break;
+        case OB_APP_MIN_COLUMN_ID + 33:
+          //queue_time_lt_10ms
+          cells[i].set_int(t.queue_time_hist_.get_cnt(1));
+          break;
+        case OB_APP_MIN_COLUMN_ID + 34:
+          //queue_time_lt_100ms
+          cells[i].set_int(t.queue_time_hist_.get_cnt(2));
+          break;
+        case OB_APP_MIN_COLUMN_ID + 35:
+          //queue_time_lt_1s
+          cells[i].set_int(t.queue_time_hist_.get_cnt(3));
+          break;
+        case OB_APP_MIN_COLUMN_ID + 36:
+          //queue_time_ge_1s
+          cells[i].set_int(t.queue_time_hist_.get_cnt(4));
+          break;
         default:
           ret = OB_ERR_UNEXPECTED;
           SERVER_LOG(WARN, "invalid column id, ", K(ret), K(col_id));
@@ -24,6 +24,8 @@ using namespace common;
 
 int64_t ObIDeadLockDetector::total_constructed_count = 0;
 int64_t ObIDeadLockDetector::total_destructed_count = 0;
+int64_t ObIDeadLockDetector::total_detected_count = 0;
+int64_t ObIDeadLockDetector::total_detect_latency = 0;
 
 OB_SERIALIZE_MEMBER(ObDetectorUserReportInfo, module_name_, resource_visitor_,
                     required_resource_, extra_columns_names_, extra_columns_values_,
@@ -49,6 +49,9 @@ class ObIDeadLockDetector : public common::LinkHashValue<UserBinaryKey>
 public:
   static int64_t total_constructed_count;
   static int64_t total_destructed_count;
+  // number of cycles detected and the sum of the time from detector creation to detection
+  static int64_t total_detected_count;
+  static int64_t total_detect_latency;
 public:
   virtual ~ObIDeadLockDetector() {};
 public:
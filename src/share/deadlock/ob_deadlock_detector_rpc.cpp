@@ -47,6 +47,29 @@ int ObDetectorLCLMessageP::process()
   return ret;
 }
 
+int ObDetectorLCLBatchMessageP::process()
+{
+  int ret = OB_SUCCESS;
+
+  DETECT_TIME_GUARD(100_ms);
+  ObDeadLockDetectorMgr *p_deadlock_detector_mgr = MTL(ObDeadLockDetectorMgr *);
+  if (OB_ISNULL(p_deadlock_detector_mgr)) {
+    DETECT_LOG(ERROR, "can not get ObDeadLockDetectorMgr", KP(p_deadlock_detector_mgr));
+  } else {
+    // messages in batch are independent, one failure should not stop the others
+    for (int64_t idx = 0; idx < arg_.count(); ++idx) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = p_deadlock_detector_mgr->process_lcl_message(arg_.at(idx)))) {
+        DETECT_LOG(WARN, "process lcl message in batch failed", KR(tmp_ret), K(arg_.at(idx)));
+        ret = tmp_ret;
+      }
+    }
+  }
+
+  result_ = Int64(ret);
+  return ret;
+}
+
 int ObDeadLockCollectInfoMessageP::process()
 {
   int ret = OB_SUCCESS;
@@ -150,6 +173,32 @@ int ObDeadLockDetectorRpc::post_lcl_message(const ObAddr &dest_addr,
   return ret;
 }
 
+int ObDeadLockDetectorRpc::post_lcl_batch_message(const ObAddr &dest_addr,
+                                                  const ObLCLBatchMessage &batch_msg)
+{
+  int ret = OB_SUCCESS;
+
+  DETECT_TIME_GUARD(100_ms);
+  if (false == is_inited_) {
+    ret = OB_NOT_INIT;
+    DETECT_LOG(WARN, "ObDeadLockDetectorRpc not inited", KR(ret));
+  } else if (false == batch_msg.is_valid() || false == dest_addr.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    DETECT_LOG(WARN, "invalid argument",
+              KR(ret), K(dest_addr), K(batch_msg));
+  } else if (OB_FAIL(proxy_->to(dest_addr)
+                           .by(MTL_ID())
+                           .timeout(OB_DETECTOR_RPC_TIMEOUT)
+                           .post_lcl_batch_message(batch_msg, &lcl_batch_msg_cb_))) {
+    DETECT_LOG(WARN, "post lcl batch request failed",
+              KR(ret), K(dest_addr), K(OB_DETECTOR_RPC_TIMEOUT), K(batch_msg.count()));
+  } else {
+    // do nothing
+  }
+
+  return ret;
+}
+
 int ObDeadLockDetectorRpc::post_collect_info_message(const ObAddr &dest_addr,
                                                      const ObDeadLockCollectInfoMessage &msg)
 {
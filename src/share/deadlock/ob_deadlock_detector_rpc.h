@@ -42,6 +42,9 @@ public:
   RPC_AP(PR5 post_notify_parent_message,
          OB_DETECTOR_NOTIFY_PARENT_MESSAGE,
          (share::detector::ObDeadLockNotifyParentMessage), Int64)
+  RPC_AP(PR5 post_lcl_batch_message,
+         OB_DETECTOR_LCL_BATCH_MESSAGE,
+         (share::detector::ObLCLBatchMessage), Int64)
 };
 
 class ObDetectorLCLMessageP : public
@@ -56,6 +59,18 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObDetectorLCLMessageP);
 };
 
+class ObDetectorLCLBatchMessageP : public
+      ObRpcProcessor<ObDetectorRpcProxy::ObRpc<OB_DETECTOR_LCL_BATCH_MESSAGE>>
+{
+public:
+  explicit ObDetectorLCLBatchMessageP(const observer::ObGlobalContext &global_ctx)
+  { UNUSED(global_ctx); }
+protected:
+  int process();
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObDetectorLCLBatchMessageP);
+};
+
 class ObDeadLockCollectInfoMessageP : public
       ObRpcProcessor<ObDetectorRpcProxy::ObRpc<OB_DETECTOR_COLLECT_INFO_MESSAGE>>
 {
@@ -139,6 +154,7 @@ public:
   void destroy();
 public:
   virtual int post_lcl_message(const ObAddr &dest_addr, const ObLCLMessage &lcl_msg);
+  virtual int post_lcl_batch_message(const ObAddr &dest_addr, const ObLCLBatchMessage &batch_msg);
   virtual int post_collect_info_message(const ObAddr &dest_addr,
                                         const ObDeadLockCollectInfoMessage &lcl_msg);
   virtual int post_notify_parent_message(const ObAddr &dest_addr,
@@ -148,6 +164,7 @@ private:
   obrpc::ObDetectorRpcProxy *proxy_;
   common::ObAddr self_;
   obrpc::ObDetectorRPCCB<obrpc::ObRpcPacketCode::OB_DETECTOR_LCL_MESSAGE> lcl_msg_cb_;
+  obrpc::ObDetectorRPCCB<obrpc::ObRpcPacketCode::OB_DETECTOR_LCL_BATCH_MESSAGE> lcl_batch_msg_cb_;
   obrpc::ObDetectorRPCCB<obrpc::ObRpcPacketCode::OB_DETECTOR_COLLECT_INFO_MESSAGE> collect_msg_cb_;
   obrpc::ObDetectorRPCCB<obrpc::ObRpcPacketCode::OB_DETECTOR_NOTIFY_PARENT_MESSAGE> notify_msg_cb_;
 };
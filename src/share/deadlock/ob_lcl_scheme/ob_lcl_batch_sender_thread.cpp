@@ -19,6 +19,8 @@
 #include "ob_lcl_parameters.h"
 #include "share/deadlock/ob_deadlock_arg_checker.h"
 #include "share/deadlock/ob_deadlock_detector_rpc.h"
+#include "observer/ob_server_struct.h"
+#include <algorithm>
 
 namespace oceanbase
 {
@@ -153,17 +155,104 @@ void ObLCLBatchSenderThread::record_summary_info_and_logout_when_necessary_(int6
     int64_t total_constructed_detector = ATOMIC_LOAD(&ObIDeadLockDetector::total_constructed_count);
     int64_t total_destructed_detector = ATOMIC_LOAD(&ObIDeadLockDetector::total_destructed_count);
     int64_t total_alived_detector = total_constructed_detector - total_destructed_detector;
+    int64_t total_detected_count = ATOMIC_LOAD(&ObIDeadLockDetector::total_detected_count);
+    int64_t total_detect_latency = ATOMIC_LOAD(&ObIDeadLockDetector::total_detect_latency);
+    int64_t avg_detect_latency = total_detected_count == 0 ? 0 : total_detect_latency / total_detected_count;
     DETECT_LOG(INFO, "ObLCLBatchSenderThread periodic report summary info",
                       K(total_constructed_detector), K(total_destructed_detector),
                       K(total_alived_detector), K(duty_ratio),
+                      K(total_detected_count), K(avg_detect_latency),
                       K(int64_t(ObServerConfig::get_instance()._lcl_op_interval)), K(*this));
     total_record_time_ = 0;
     total_busy_time_ = 0;
     over_night_times_ = 0;
+    local_msg_count_ = 0;
+    remote_msg_count_ = 0;
+    rpc_count_ = 0;
     duty_ratio = 0;
   }
 }
 
+// OB_DETECTOR_LCL_BATCH_MESSAGE is unknown to servers built before it, and they report the same
+// cluster version, so messages are sent one by one until the batch rpc is turned on by config
+bool ObLCLBatchSenderThread::is_batch_msg_supported_()
+{
+  return ObServerConfig::get_instance()._enable_lcl_batch_message;
+}
+
+int ObLCLBatchSenderThread::post_msg_(const ObLCLMessage &msg)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(mgr_->get_rpc().post_lcl_message(msg.get_addr(), msg))) {
+    DETECT_LOG(WARN, "send LCL msg failed", KR(ret), K(msg));
+  } else {
+    ++rpc_count_;
+    ++remote_msg_count_;
+  }
+  return ret;
+}
+
+int ObLCLBatchSenderThread::flush_batch_(const ObAddr &dest_addr, ObLCLBatchMessage &batch_msg)
+{
+  int ret = OB_SUCCESS;
+  if (batch_msg.empty()) {
+    // do nothing
+  } else if (1 == batch_msg.count() || !is_batch_msg_supported_()) {
+    // messages are independent, one failure should not stop the others
+    for (int64_t idx = 0; idx < batch_msg.count(); ++idx) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = post_msg_(batch_msg.at(idx)))) {
+        ret = tmp_ret;
+      }
+    }
+  } else if (OB_FAIL(mgr_->get_rpc().post_lcl_batch_message(dest_addr, batch_msg))) {
+    DETECT_LOG(WARN, "send LCL batch msg failed", KR(ret), K(dest_addr), K(batch_msg.count()));
+  } else {
+    ++rpc_count_;
+    remote_msg_count_ += batch_msg.count();
+  }
+  batch_msg.reset();
+  return ret;
+}
+
+// Messages to detectors on this server are delivered directly, so that cycles formed only by local
+// waiters are found without any RPC. Messages to the same remote server are sent in batches.
+void ObLCLBatchSenderThread::send_msgs_(ObArray<ObLCLMessage> &msg_list)
+{
+  int ret = OB_SUCCESS;
+  ObLCLBatchMessage batch_msg;
+  ObAddr batch_addr;
+  const ObAddr &self_addr = GCTX.self_addr();
+
+  DETECT_TIME_GUARD(100_ms);
+  if (msg_list.count() > 1) {
+    std::sort(&msg_list.at(0), &msg_list.at(0) + msg_list.count(),
+              [](const ObLCLMessage &lhs, const ObLCLMessage &rhs) {
+                return lhs.get_addr() < rhs.get_addr();
+              });
+  }
+  for (int64_t idx = 0; idx < msg_list.count(); ++idx) {
+    const ObLCLMessage &msg = msg_list.at(idx);
+    if (msg.get_addr() == self_addr) {
+      if (OB_FAIL(mgr_->process_lcl_message(msg))) {
+        DETECT_LOG(WARN, "process local LCL msg failed", KR(ret), K(msg));
+      }
+      ++local_msg_count_;
+    } else {
+      if (batch_addr != msg.get_addr() || batch_msg.is_full()) {
+        (void) flush_batch_(batch_addr, batch_msg);
+        batch_addr = msg.get_addr();
+      }
+      if (OB_FAIL(batch_msg.push_back(msg))) {
+        DETECT_LOG(WARN, "push LCL msg to batch failed, send it alone", KR(ret), K(msg));
+        (void) post_msg_(msg);
+      }
+    }
+    CLICK();
+  }
+  (void) flush_batch_(batch_addr, batch_msg);
+}
+
 void ObLCLBatchSenderThread::run1()
 {
   int ret = OB_SUCCESS;
@@ -194,15 +283,7 @@ void ObLCLBatchSenderThread::run1()
         DETECT_LOG(WARN, "can't fill mock_lcl_message_list", KR(ret));
       }
       CLICK();
-      for (int64_t idx = 0; idx < mock_lcl_message_list.count(); ++idx) {
-        const ObLCLMessage &msg = mock_lcl_message_list.at(idx);
-        if (OB_FAIL(mgr_->get_rpc().post_lcl_message(msg.get_addr(), msg))) {
-          DETECT_LOG(WARN, "send LCL msg failed", KR(ret), K(msg));
-          CLICK();
-        } else {
-          DETECT_LOG(DEBUG, "send LCL msg success", K(msg));
-        }
-      }
+      send_msgs_(mock_lcl_message_list);
     }
     
     end_ts = ObClockGenerator::getRealClock();
@@ -38,6 +38,9 @@ public:
   total_record_time_(0),
   total_busy_time_(0),
   over_night_times_(0),
+  local_msg_count_(0),
+  remote_msg_count_(0),
+  rpc_count_(0),
   mgr_(mgr) {}
   ~ObLCLBatchSenderThread() { destroy(); }
   int init();
@@ -49,7 +52,8 @@ public:
 public:
   int cache_msg(const ObDependencyResource &key,
                 const ObLCLMessage &lcl_msg);
-  TO_STRING_KV(KP(this), K_(is_inited), K_(is_running), K_(total_record_time), K_(over_night_times));
+  TO_STRING_KV(KP(this), K_(is_inited), K_(is_running), K_(total_record_time), K_(over_night_times),
+               K_(local_msg_count), K_(remote_msg_count), K_(rpc_count));
 private:
   class RemoveIfOp
   {
@@ -69,6 +73,10 @@ private:
   };
 private:
   int64_t update_and_get_lcl_op_interval_();
+  void send_msgs_(common::ObArray<ObLCLMessage> &msg_list);
+  int flush_batch_(const common::ObAddr &dest_addr, ObLCLBatchMessage &batch_msg);
+  int post_msg_(const ObLCLMessage &msg);
+  static bool is_batch_msg_supported_();
   void record_summary_info_and_logout_when_necessary_(int64_t, int64_t, int64_t);
 private:
   bool is_inited_;
@@ -76,6 +84,10 @@ private:
   int64_t total_record_time_;
   int64_t total_busy_time_;
   int64_t over_night_times_;
+  // messages delivered to detectors on this server without RPC
+  int64_t local_msg_count_;
+  int64_t remote_msg_count_;
+  int64_t rpc_count_;
   ObDeadLockDetectorMgr* mgr_;
   common::ObLinearHashMap<ObDependencyResource, ObLCLMessage> lcl_msg_map_;
 };
@@ -77,6 +77,17 @@ int ObLCLMessage::set_args(const common::ObAddr &dest_addr,
   return ret;
 }
 
+OB_SERIALIZE_MEMBER(ObLCLBatchMessage, msgs_);
+
+bool ObLCLBatchMessage::is_valid() const
+{
+  bool bool_ret = !msgs_.empty();
+  for (int64_t idx = 0; idx < msgs_.count() && bool_ret; ++idx) {
+    bool_ret = msgs_.at(idx).is_valid();
+  }
+  return bool_ret;
+}
+
 }
 }
 }
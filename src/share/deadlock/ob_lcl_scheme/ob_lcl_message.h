@@ -57,6 +57,27 @@ private:
   int64_t send_ts_;
 };
 
+// LCL messages sent to the same server in one LCL op interval are packed into one batch message to
+// avoid a RPC per detector edge under heavy lock contention
+class ObLCLBatchMessage
+{
+  OB_UNIS_VERSION(1);
+public:
+  static const int64_t MAX_MSG_CNT_PER_BATCH = 128;
+public:
+  ObLCLBatchMessage() : msgs_() {}
+  void reset() { msgs_.reset(); }
+  int push_back(const ObLCLMessage &msg) { return msgs_.push_back(msg); }
+  bool is_valid() const;
+  bool is_full() const { return msgs_.count() >= MAX_MSG_CNT_PER_BATCH; }
+  bool empty() const { return msgs_.empty(); }
+  int64_t count() const { return msgs_.count(); }
+  const ObLCLMessage &at(const int64_t idx) const { return msgs_.at(idx); }
+  TO_STRING_KV("count", msgs_.count(), K_(msgs));
+private:
+  common::ObSArray<ObLCLMessage> msgs_;
+};
+
 }// namespace detector
 }// namespace share
 }// namespace oceanbase
@@ -577,7 +577,10 @@ int ObLCLNode::process_msg_as_lcls_msg_(const ObLCLMessage &lcl_msg,
                             K(lcl_msg), K(*this)); 
         }
       } else {
-        DETECT_LOG_(INFO, "detect cycle", K(lcl_msg), K(*this));
+        const int64_t detect_latency = ObClockGenerator::getRealClock() - created_time_;
+        ATOMIC_INC(&ObIDeadLockDetector::total_detected_count);
+        ATOMIC_AAF(&ObIDeadLockDetector::total_detect_latency, detect_latency);
+        DETECT_LOG_(INFO, "detect cycle", K(detect_latency), K(lcl_msg), K(*this));
         last_send_collect_info_period_ = lcl_period_;
         detected_flag = true;
       }
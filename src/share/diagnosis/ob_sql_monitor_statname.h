@@ -44,6 +44,9 @@ SQL_MONITOR_STATNAME_DEF(MEMORY_DUMP, sql_monitor_statname::CAPACITY, "memory du
 // GI
 SQL_MONITOR_STATNAME_DEF(FILTERED_GRANULE_COUNT, sql_monitor_statname::INT, "filtered granule count", "filtered granule count in GI op")
 SQL_MONITOR_STATNAME_DEF(TOTAL_GRANULE_COUNT, sql_monitor_statname::INT, "total granule count", "total granule count in GI op")
+// JOIN FILTER
+SQL_MONITOR_STATNAME_DEF(JOIN_FILTER_RANGE_FILTERED_COUNT, sql_monitor_statname::INT, "range filtered row count", "filtered row count by min/max range of join filter")
+SQL_MONITOR_STATNAME_DEF(JOIN_FILTER_IN_FILTERED_COUNT, sql_monitor_statname::INT, "in filtered row count", "filtered row count by in list of join filter")
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
 #endif
@@ -5588,7 +5588,8 @@ def_table_schema(
     ('lc_node', 'int'),
     ('lc_node_rd', 'int'),
     ('lc_node_wr', 'int'),
-    ('lc_ref_cache_obj_stat', 'int')
+    ('lc_ref_cache_obj_stat', 'int'),
+    ('shared_fragment_mem_saved', 'int')
   ],
   partition_columns = ['svr_ip', 'svr_port'],
   vtable_route_policy = 'distributed',
@@ -7185,6 +7186,11 @@ def_table_schema(
     ('queue_4', 'bigint:20'),
     ('queue_5', 'bigint:20'),
     ('large_queued', 'bigint:20'),
+    ('queue_time_lt_1ms', 'bigint:20'),
+    ('queue_time_lt_10ms', 'bigint:20'),
+    ('queue_time_lt_100ms', 'bigint:20'),
+    ('queue_time_lt_1s', 'bigint:20'),
+    ('queue_time_ge_1s', 'bigint:20'),
   ],
   partition_columns = ['svr_ip', 'svr_port'],
   vtable_route_policy = 'distributed',
@@ -395,6 +395,11 @@ DEF_INT(_enable_hash_join_processor, OB_TENANT_PARAMETER, "7", "[1, 7]",
          "which path to process for hash join, default 7 to auto choose "
          "1: nest loop, 2: recursive, 4: in-memory",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_load_data_direct_path, OB_TENANT_PARAMETER, "False",
+         "enable LOAD DATA to write sorted rows into major sstable directly, "
+         "only empty non-partitioned tables with primary key and without index are supported "
+         "Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_pushdown_storage_level, OB_TENANT_PARAMETER, "3", "[0, 3]",
         "the level of storage pushdown. Range: [0, 3] "
         "0: disabled, 1:blockscan, 2: blockscan & filter, 3: blockscan & filter & aggregate",
@@ -609,6 +614,10 @@ DEF_TIME(_lcl_op_interval, OB_CLUSTER_PARAMETER, "30ms", "[0ms, 1s]",
          "Scan interval for every detector node, smaller interval support larger deadlock scale, but cost more system resource. "
          "0ms means disable deadlock, default value is 30ms. Range:[0ms, 1s]",
          ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_lcl_batch_message, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the LCL messages to the same server are sent by one batch rpc, "
+         "turn it on only after all servers in the cluster are able to process the batch rpc",
+         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(enable_sys_unit_standalone, OB_CLUSTER_PARAMETER, "False",
          "specifies whether sys unit standalone deployment is turned on. "
@@ -658,6 +667,13 @@ DEF_BOOL(enable_early_lock_release, OB_TENANT_PARAMETER, "False",
 DEF_TIME(_ob_get_gts_ahead_interval, OB_CLUSTER_PARAMETER, "0s", "[0s, 1s]",
          "get gts ahead interval. Range: [0s, 1s]",
          ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_gts_lease_time, OB_CLUSTER_PARAMETER, "0ms", "[0ms, 1s]",
+         "the lease within which a server can generate gts locally after receiving a gts response "
+         "from the gts leader, 0 means disabled. Range: [0ms, 1s]",
+         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_gts_clock_uncertainty, OB_CLUSTER_PARAMETER, "1ms", "[0ms, 100ms]",
+         "the max clock offset between servers that gts lease relies on. Range: [0ms, 100ms]",
+         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 //// rpc config
 DEF_TIME(rpc_timeout, OB_CLUSTER_PARAMETER, "2s",
@@ -999,6 +1015,12 @@ DEF_BOOL(_enable_dist_data_access_service, OB_TENANT_PARAMETER, "True",
          "enable use das service",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(_enable_das_async_access, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the remote scan tasks of a das batch are sent by async rpc and "
+         "overlapped with the local ones, "
+         "turn it on only after all servers in the cluster are able to process the async rpc",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 DEF_INT(_bloom_filter_ratio, OB_CLUSTER_PARAMETER, "35", "[0, 100]",
         "the px bloom filter false-positive rate.the default value is 1, range: [0,100]",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1214,6 +1236,11 @@ DEF_BOOL(_enable_trace_session_leak, OB_CLUSTER_PARAMETER, "False",
 DEF_BOOL(_ob_enable_fast_parser, OB_CLUSTER_PARAMETER, "True",
          "control if enable fast parser",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_session_plan_hit_cache_size, OB_TENANT_PARAMETER, "8", "[0, 64]",
+        "the number of plans hit by raw sql text remembered in each session, "
+        "identical text executed again in the session skips fast parser and plan matching, "
+        "0 means disabled. Range: [0, 64]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_TIME(_ob_obj_dep_maint_task_interval, OB_CLUSTER_PARAMETER, "1ms", "[0,10s]",
          "The execution interval of the task of maintaining the dependency of the object. "\
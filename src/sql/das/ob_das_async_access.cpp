@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DAS
+#include "sql/das/ob_das_async_access.h"
+#include "lib/worker.h"
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+int ObDASAsyncAccessCB::process()
+{
+  finish(CB_PROCESSED);
+  return OB_SUCCESS;
+}
+
+void ObDASAsyncAccessCB::on_invalid()
+{
+  LOG_WARN("das async access callback invalid, check object serialization impl or oom",
+           K_(trace_id));
+  finish(CB_INVALID);
+}
+
+void ObDASAsyncAccessCB::on_timeout()
+{
+  LOG_WARN("das async access callback timeout, check timeout value, peer cpu load, "
+           "network packet drop rate", K_(trace_id));
+  finish(CB_TIMEOUT);
+}
+
+rpc::frame::ObReqTransport::AsyncCB *ObDASAsyncAccessCB::clone(const rpc::frame::SPAlloc &alloc) const
+{
+  UNUSED(alloc);
+  // the callback is owned by ObDASAsyncCbMgr, which waits until rpc framework finishes with it
+  return const_cast<rpc::frame::ObReqTransport::AsyncCB *>(
+      static_cast<const rpc::frame::ObReqTransport::AsyncCB *const>(this));
+}
+
+int ObDASAsyncAccessCB::get_rpc_ret() const
+{
+  int ret = OB_SUCCESS;
+  switch (state_) {
+    case CB_PROCESSED:
+      ret = rcode_.rcode_;
+      break;
+    case CB_TIMEOUT:
+      ret = OB_TIMEOUT;
+      break;
+    case CB_INVALID:
+      ret = OB_RPC_PACKET_INVALID;
+      break;
+    default:
+      ret = OB_ERR_UNEXPECTED;
+      break;
+  }
+  return ret;
+}
+
+void ObDASAsyncAccessCB::finish(CbState state)
+{
+  ObThreadCondGuard guard(cb_mgr_.cond_);
+  state_ = state;
+  cb_mgr_.on_cb_finished();
+}
+
+int ObDASAsyncCbMgr::init()
+{
+  return cond_.init(ObWaitEventIds::ASYNC_RPC_PROXY_COND_WAIT);
+}
+
+void ObDASAsyncCbMgr::destroy()
+{
+  // the memory of callbacks belongs to das ref allocator
+  for (int64_t i = 0; i < cb_list_.count(); ++i) {
+    if (OB_NOT_NULL(cb_list_.at(i))) {
+      cb_list_.at(i)->~ObDASAsyncAccessCB();
+    }
+  }
+  cb_list_.reset();
+  finished_cnt_ = 0;
+  cond_.destroy();
+}
+
+void ObDASAsyncCbMgr::on_cb_finished()
+{
+  // under the protection of cond_
+  ++finished_cnt_;
+  (void)cond_.broadcast();
+}
+
+int ObDASAsyncCbMgr::wait_all()
+{
+  int ret = OB_SUCCESS;
+  if (!cb_list_.empty()) {
+    // notify omt that maybe I'd begin to wait
+    THIS_WORKER.sched_wait();
+    {
+      ObThreadCondGuard guard(cond_);
+      while (finished_cnt_ < cb_list_.count()) {
+        (void)cond_.wait_us(WAIT_INTERVAL_US);
+        // keep waiting the in-flight callbacks after the worker is interrupted,
+        // rpc thread may still decode into the op results
+        if (OB_SUCC(ret) && OB_FAIL(THIS_WORKER.check_status())) {
+          LOG_WARN("worker interrupted while waiting das async access", K(ret), KPC(this));
+        }
+      }
+    }
+    THIS_WORKER.sched_run();
+  }
+  return ret;
+}
+}  // namespace sql
+}  // namespace oceanbase
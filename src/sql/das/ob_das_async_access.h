@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OBDEV_SRC_SQL_DAS_OB_DAS_ASYNC_ACCESS_H_
+#define OBDEV_SRC_SQL_DAS_OB_DAS_ASYNC_ACCESS_H_
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/profile/ob_trace_id.h"
+#include "sql/das/ob_das_rpc_proxy.h"
+namespace oceanbase
+{
+namespace sql
+{
+class ObDASAsyncCbMgr;
+
+// callback of the remote das tasks sent to one server by an async rpc.
+// The response is decoded by rpc thread into the op result prepared by controller,
+// then the worker waiting on ObDASAsyncCbMgr is woken up to consume it.
+class ObDASAsyncAccessCB : public obrpc::ObDASRpcProxy::AsyncCB<obrpc::OB_DAS_ASYNC_ACCESS>
+{
+public:
+  enum CbState
+  {
+    CB_WAITING = 0,
+    CB_PROCESSED,
+    CB_TIMEOUT,
+    CB_INVALID
+  };
+public:
+  ObDASAsyncAccessCB(ObDASAsyncCbMgr &cb_mgr,
+                     const common::ObCurTraceId::TraceId &trace_id)
+    : cb_mgr_(cb_mgr),
+      task_ops_(),
+      trace_id_(trace_id),
+      state_(CB_WAITING)
+  { }
+  virtual ~ObDASAsyncAccessCB() { }
+  virtual int process() override;
+  virtual void on_invalid() override;
+  virtual void on_timeout() override;
+  virtual rpc::frame::ObReqTransport::AsyncCB *clone(const rpc::frame::SPAlloc &alloc) const override;
+  virtual void set_args(const Request &arg) override { UNUSED(arg); }
+  ObDASTaskResp &get_task_resp() { return result_; }
+  int add_task_op(ObIDASTaskOp *task_op) { return task_ops_.push_back(task_op); }
+  // the task ops sent to one server together, in the order of the op results of task resp
+  const common::ObIArray<ObIDASTaskOp*> &get_task_ops() const { return task_ops_; }
+  bool is_finished() const { return CB_WAITING != state_; }
+  // error of rpc framework, the error of task execution is carried by task resp
+  int get_rpc_ret() const;
+  TO_STRING_KV("task_cnt", task_ops_.count(), K_(trace_id), K_(state), K_(rcode));
+private:
+  void finish(CbState state);
+private:
+  ObDASAsyncCbMgr &cb_mgr_;
+  common::ObSEArray<ObIDASTaskOp*, 4> task_ops_;
+  common::ObCurTraceId::TraceId trace_id_;
+  CbState state_;
+  DISALLOW_COPY_AND_ASSIGN(ObDASAsyncAccessCB);
+};
+
+// the in-flight async das tasks of one batch, the worker sends all remote tasks of the batch
+// at first, executes the local tasks while they are in flight and waits here only once
+class ObDASAsyncCbMgr
+{
+  friend class ObDASAsyncAccessCB;
+public:
+  ObDASAsyncCbMgr()
+    : cond_(),
+      cb_list_(),
+      finished_cnt_(0)
+  { }
+  ~ObDASAsyncCbMgr() { destroy(); }
+  int init();
+  void destroy();
+  int add_cb(ObDASAsyncAccessCB *cb) { return cb_list_.push_back(cb); }
+  // the callbacks refer to the memory of das ref, so they are always waited until rpc
+  // framework finishes with them, rpc timeout guarantees that the waiting ends.
+  // the worker status is checked while waiting, if it is killed or timeout, the error is
+  // returned after all callbacks finish and their results should not be collected
+  int wait_all();
+  common::ObIArray<ObDASAsyncAccessCB*> &get_cb_list() { return cb_list_; }
+  TO_STRING_KV(K_(finished_cnt), "cb_cnt", cb_list_.count());
+private:
+  void on_cb_finished();
+private:
+  static const int64_t WAIT_INTERVAL_US = 10 * 1000;
+  common::ObThreadCond cond_;
+  common::ObSEArray<ObDASAsyncAccessCB*, 4> cb_list_;
+  int64_t finished_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObDASAsyncCbMgr);
+};
+}  // namespace sql
+}  // namespace oceanbase
+#endif /* OBDEV_SRC_SQL_DAS_OB_DAS_ASYNC_ACCESS_H_ */
@@ -116,9 +116,12 @@ int ObDASDeleteOp::decode_task_result(ObIDASTaskResult *task_result)
   return ret;
 }
 
-int ObDASDeleteOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
+int ObDASDeleteOp::fill_task_result(ObIDASTaskResult &task_result,
+                                    bool &has_more,
+                                    const int64_t memory_limit)
 {
   int ret = OB_SUCCESS;
+  UNUSED(memory_limit);
 #if !defined(NDEBUG)
   CK(typeid(task_result) == typeid(ObDASDeleteResult));
 #endif
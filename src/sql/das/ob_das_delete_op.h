@@ -30,7 +30,9 @@ public:
   virtual int open_op() override;
   virtual int release_op() override;
   virtual int decode_task_result(ObIDASTaskResult *task_result) override;
-  virtual int fill_task_result(ObIDASTaskResult &task_result, bool &has_more) override;
+  virtual int fill_task_result(ObIDASTaskResult &task_result,
+                               bool &has_more,
+                               const int64_t memory_limit) override;
   virtual int init_task_info() override;
   virtual int swizzling_remote_task(ObDASRemoteInfo *remote_info) override;
   virtual const ObDASBaseCtDef *get_ctdef() const override { return del_ctdef_; }
@@ -302,9 +302,12 @@ int ObDASInsertOp::decode_task_result(ObIDASTaskResult *task_result)
   return ret;
 }
 
-int ObDASInsertOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
+int ObDASInsertOp::fill_task_result(ObIDASTaskResult &task_result,
+                                    bool &has_more,
+                                    const int64_t memory_limit)
 {
   int ret = OB_SUCCESS;
+  UNUSED(memory_limit);
 #if !defined(NDEBUG)
   CK(typeid(task_result) == typeid(ObDASInsertResult));
 #endif
@@ -92,9 +92,12 @@ int ObDASLockOp::decode_task_result(ObIDASTaskResult *task_result)
   return ret;
 }
 
-int ObDASLockOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
+int ObDASLockOp::fill_task_result(ObIDASTaskResult &task_result,
+                                  bool &has_more,
+                                  const int64_t memory_limit)
 {
   int ret = OB_SUCCESS;
+  UNUSED(memory_limit);
 #if !defined(NDEBUG)
   CK(typeid(task_result) == typeid(ObDASLockResult));
 #endif
@@ -14,6 +14,7 @@
 #include "sql/das/ob_das_ref.h"
 #include "sql/das/ob_das_extra_data.h"
 #include "sql/das/ob_data_access_service.h"
+#include "sql/das/ob_das_async_access.h"
 #include "sql/das/ob_das_scan_op.h"
 #include "sql/das/ob_das_insert_op.h"
 #include "sql/das/ob_das_utils.h"
@@ -217,6 +218,10 @@ int ObDASRef::execute_all_task()
   bool DAS_TASK_AGGREGATION = false;
   if (DAS_TASK_AGGREGATION) {
     // TODO(roland.qk): DAS task aggregation.
+  } else if (need_async_access()) {
+    if (OB_FAIL(execute_all_task_async())) {
+      LOG_WARN("execute all das task async failed", K(ret));
+    }
   } else {
     DASTaskIter task_iter = begin_task_iter();
     while (OB_SUCC(ret) && !task_iter.is_end()) {
@@ -230,6 +235,94 @@ int ObDASRef::execute_all_task()
   return ret;
 }
 
+bool ObDASRef::need_async_access() const
+{
+  bool bret = false;
+  // OB_DAS_ASYNC_ACCESS is unknown to the servers of older builds, which report the same
+  // cluster version, so it is turned on by the parameter after all servers are upgraded
+  if (!execute_directly_
+      && batched_tasks_.get_size() > 1
+      && GCONF._enable_das_async_access) {
+    ObDataAccessService *das = MTL(ObDataAccessService*);
+    bool has_dml = false;
+    bool has_async_task = false;
+    DLIST_FOREACH_X(curr, batched_tasks_.get_obj_list(), !has_dml) {
+      const ObIDASTaskOp *task_op = curr->get_obj();
+      if (IS_DAS_DML_OP(*task_op)) {
+        // dml tasks keep executing one by one in the order of the list
+        has_dml = true;
+      } else if (das->can_async_access(*this, *task_op)) {
+        has_async_task = true;
+      }
+    }
+    bret = !has_dml && has_async_task;
+  }
+  return bret;
+}
+
+int ObDASRef::execute_all_task_async()
+{
+  int ret = OB_SUCCESS;
+  ObDataAccessService *das = MTL(ObDataAccessService*);
+  ObDASAsyncCbMgr cb_mgr;
+  if (OB_FAIL(cb_mgr.init())) {
+    LOG_WARN("init das async callback manager failed", K(ret));
+  } else {
+    // send all remote tasks at first, local tasks are executed while they are in flight.
+    // the remote tasks to the same server are coalesced into one rpc
+    ObSEArray<ObIDASTaskOp*, 16> async_tasks;
+    DASTaskIter task_iter = begin_task_iter();
+    while (OB_SUCC(ret) && !task_iter.is_end()) {
+      if (das->can_async_access(*this, **task_iter)
+          && OB_FAIL(async_tasks.push_back(*task_iter))) {
+        LOG_WARN("store async das task failed", K(ret));
+      }
+      ++task_iter;
+    }
+    if (OB_SUCC(ret)) {
+      auto svr_cmp = [](const ObIDASTaskOp *l, const ObIDASTaskOp *r) -> bool {
+        return l->get_tablet_loc()->server_ < r->get_tablet_loc()->server_;
+      };
+      std::sort(async_tasks.begin(), async_tasks.end(), svr_cmp);
+    }
+    ObSEArray<ObIDASTaskOp*, 16> rpc_tasks;
+    for (int64_t i = 0; OB_SUCC(ret) && i < async_tasks.count(); ++i) {
+      if (OB_FAIL(rpc_tasks.push_back(async_tasks.at(i)))) {
+        LOG_WARN("store async das task failed", K(ret));
+      } else if (i + 1 == async_tasks.count()
+                 || rpc_tasks.count() >= ObDataAccessService::MAX_ASYNC_TASK_CNT_PER_RPC
+                 || async_tasks.at(i + 1)->get_tablet_loc()->server_
+                    != async_tasks.at(i)->get_tablet_loc()->server_) {
+        if (OB_FAIL(das->execute_das_task_async(*this, cb_mgr, rpc_tasks))) {
+          LOG_WARN("execute das task async failed", K(ret));
+        }
+        rpc_tasks.reuse();
+      }
+    }
+    task_iter = begin_task_iter();
+    while (OB_SUCC(ret) && !task_iter.is_end()) {
+      if (!das->can_async_access(*this, **task_iter)
+          && OB_FAIL(das->execute_das_task(*this, **task_iter))) {
+        LOG_WARN("execute das task failed", K(ret));
+      }
+      ++task_iter;
+    }
+    // the callbacks refer to the tasks, wait for all of them even if some task failed
+    int wait_ret = cb_mgr.wait_all();
+    if (OB_SUCC(ret) && OB_SUCCESS != wait_ret) {
+      ret = wait_ret;
+      LOG_WARN("wait das async access failed", K(ret));
+    }
+    ObIArray<ObDASAsyncAccessCB*> &cb_list = cb_mgr.get_cb_list();
+    for (int64_t i = 0; OB_SUCC(ret) && i < cb_list.count(); ++i) {
+      if (OB_FAIL(das->collect_async_das_task(*this, *cb_list.at(i)))) {
+        LOG_WARN("collect async das task failed", K(ret), KPC(cb_list.at(i)));
+      }
+    }
+  }
+  return ret;
+}
+
 void ObDASRef::set_frozen_node()
 {
   frozen_op_node_ = batched_tasks_.get_last_node();
@@ -94,6 +94,8 @@ public:
 private:
   DISABLE_COPY_ASSIGN(ObDASRef);
   int create_task_map();
+  bool need_async_access() const;
+  int execute_all_task_async();
 private:
   typedef common::ObObjNode<ObIDASTaskOp*> DasOpNode;
   //declare das allocator
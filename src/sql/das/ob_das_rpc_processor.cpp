@@ -21,11 +21,12 @@ namespace oceanbase
 {
 namespace sql
 {
-int ObDASSyncAccessP::init()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::init()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASSyncAccessP::get_das_factory() = &das_factory_;
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  get_das_factory() = &das_factory_;
   das_remote_info_.exec_ctx_ = &exec_ctx_;
   das_remote_info_.frame_info_ = &frame_info_;
   task.set_remote_info(&das_remote_info_);
@@ -33,76 +34,75 @@ int ObDASSyncAccessP::init()
   return ret;
 }
 
-int ObDASSyncAccessP::before_process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::before_process()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
-  ObIDASTaskResult *task_result = nullptr;
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  ObDASTaskResp &task_resp = RpcProcessor::result_;
+  const ObIArray<ObIDASTaskOp*> &task_ops = task.get_task_ops();
   ObMemAttr mem_attr;
-  mem_attr.tenant_id_ = task.get_task_op()->get_tenant_id();
   mem_attr.label_ = "DASRpcPCtx";
-  exec_ctx_.get_allocator().set_attr(mem_attr);
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_factory();
   if (OB_ISNULL(das_factory)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("das factory is not inited", K(ret));
-  } else if (OB_FAIL(ObDASSyncRpcProcessor::before_process())) {
+  } else if (OB_UNLIKELY(task_ops.empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("das task arg has no task op", K(ret), K(task));
+  } else if (FALSE_IT(mem_attr.tenant_id_ = task_ops.at(0)->get_tenant_id())) {
+  } else if (FALSE_IT(exec_ctx_.get_allocator().set_attr(mem_attr))) {
+  } else if (OB_FAIL(RpcProcessor::before_process())) {
     LOG_WARN("do rpc processor before_process failed", K(ret));
   } else if (das_remote_info_.need_calc_udf_ &&
       OB_FAIL(GCTX.schema_service_->get_tenant_schema_guard(MTL_ID(), schema_guard_))) {
     LOG_WARN("fail to get schema guard", K(ret));
-  } else if (OB_FAIL(das_factory->create_das_task_result(task.get_task_op()->get_type(),
-                                                         task_result))) {
-    LOG_WARN("create das task result failed", K(ret), K(task));
-  } else if (OB_FAIL(task_result->init(*task.get_task_op()))) {
-    LOG_WARN("init task result failed", K(ret), KPC(task_result), KPC(task.get_task_op()));
-  } else if (OB_FAIL(task_resp.add_op_result(task_result))) {
-    LOG_WARN("failed to add das op result", K(ret), K(*task_result));
-  } else {
+  }
+  // the async access carries all the task ops of the controller to this server,
+  // results are returned in the order of task ops
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    ObIDASTaskResult *task_result = nullptr;
+    if (OB_FAIL(das_factory->create_das_task_result(task_ops.at(i)->get_type(),
+                                                    task_result))) {
+      LOG_WARN("create das task result failed", K(ret), K(task));
+    } else if (OB_FAIL(task_result->init(*task_ops.at(i)))) {
+      LOG_WARN("init task result failed", K(ret), KPC(task_result), KPC(task_ops.at(i)));
+    } else if (OB_FAIL(task_resp.add_op_result(task_result))) {
+      LOG_WARN("failed to add das op result", K(ret), K(*task_result));
+    }
+  }
+  if (OB_SUCC(ret)) {
     exec_ctx_.get_sql_ctx()->schema_guard_ = &schema_guard_;
   }
   return ret;
 }
 
-int ObDASSyncAccessP::process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::process()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
-  ObIDASTaskOp *task_op = task.get_task_op();
-  ObIDASTaskResult *task_result = task_resp.get_op_result();
-  bool has_more = false;
-  //regardless of the success of the task execution, the fllowing meta info must be set
-  task_result->set_task_id(task_op->get_task_id());
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  ObDASTaskResp &task_resp = RpcProcessor::result_;
+  const ObIArray<ObIDASTaskOp*> &task_ops = task.get_task_ops();
+  ObDataAccessService *das = MTL(ObDataAccessService*);
+  int64_t executed_cnt = 0;
   task_resp.set_ctrl_svr(task.get_ctrl_svr());
   task_resp.set_runner_svr(task.get_runner_svr());
-  if (OB_ISNULL(task_op) || OB_ISNULL(task_result)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("task op is nullptr", K(ret), K(task_op), K(task_result));
-  } else if (OB_FAIL(task_op->start_das_task())) {
-    LOG_WARN("start das task failed", K(ret));
-  } else if (OB_FAIL(task_op->fill_task_result(*task_result, has_more))) {
-    LOG_WARN("fill task result to controller failed", K(ret));
-  } else if (OB_UNLIKELY(has_more) && OB_FAIL(task_op->fill_extra_result())) {
-    LOG_WARN("fill extra result to controller failed", KR(ret));
-  } else {
-    task_resp.set_has_more(has_more);
+  if (OB_FAIL(das->execute_remote_task_ops(task_ops, task_resp, executed_cnt))) {
+    LOG_WARN("execute remote das task ops failed", K(ret), K(task));
+  }
+  if (OB_SUCC(ret)) {
     ObWarningBuffer *wb = ob_get_tsi_warning_buffer();
     if (wb != nullptr) {
       //ignore the errcode of storing warning msg
       (void)task_resp.store_warning_msg(*wb);
     }
   }
-  //因为end_task还有可能失败，需要通过RPC将end_task的返回值带回到scheduler上
-  if (OB_NOT_NULL(task_op)) {
-    int tmp_ret = task_op->end_das_task();
-    if (OB_SUCCESS != tmp_ret) {
-      LOG_WARN("end das task failed", K(ret), K(tmp_ret), K(task));
-    }
-    ret = COVER_SUCC(tmp_ret);
+  if (!task_ops.empty() && OB_NOT_NULL(task_ops.at(0))) {
+    // the task ops share the trans desc of das remote info
+    ObIDASTaskOp *task_op = task_ops.at(0);
     if (OB_NOT_NULL(task_op->get_trans_desc())) {
-      tmp_ret = MTL(transaction::ObTransService*)
+      int tmp_ret = MTL(transaction::ObTransService*)
         ->get_tx_exec_result(*task_op->get_trans_desc(),
                             task_resp.get_trans_result());
       if (OB_SUCCESS != tmp_ret) {
@@ -114,39 +114,46 @@ int ObDASSyncAccessP::process()
       ret = GSCHEMASERVICE.is_schema_error_need_retry(NULL, task_op->get_tenant_id()) ?
             OB_ERR_REMOTE_SCHEMA_NOT_FULL : OB_ERR_WAIT_REMOTE_SCHEMA_REFRESH;
     }
-    task_resp.set_err_code(ret);
-    if (OB_SUCCESS != ret) {
-      task_resp.store_err_msg(ob_get_tsi_err_msg(ret));
-      LOG_WARN("process das sync access task failed", K(ret),
-              K(task.get_ctrl_svr()), K(task.get_runner_svr()));
-    }
   }
-  LOG_DEBUG("process das sync access task", K(ret), K(task), KPC(task_result), K(has_more));
+  task_resp.set_err_code(ret);
+  if (OB_SUCCESS != ret) {
+    task_resp.store_err_msg(ob_get_tsi_err_msg(ret));
+    LOG_WARN("process das access task failed", K(ret),
+            K(task.get_ctrl_svr()), K(task.get_runner_svr()));
+    // the controller drops the whole response and retries each task op alone
+    das->erase_remote_task_results(task_ops, executed_cnt);
+  }
+  LOG_DEBUG("process das access task", K(ret), K(task), K(task_resp));
   return OB_SUCCESS;
 }
 
-int ObDASSyncAccessP::after_process(int error_code)
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::after_process(int error_code)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(ObDASSyncRpcProcessor::after_process(error_code))) {
+  if (OB_FAIL(RpcProcessor::after_process(error_code))) {
     LOG_WARN("do das sync base rpc process failed", K(ret));
   }
   //执行相关的错误信息不用传递给RPC框架，RPC框架不处理具体的RPC执行错误信息，始终返回OB_SUCCESS
   return OB_SUCCESS;
 }
 
-void ObDASSyncAccessP::cleanup()
+template <obrpc::ObRpcPacketCode pcode>
+void ObDASBaseAccessP<pcode>::cleanup()
 {
   ObActiveSessionGuard::setup_default_ash();
   das_factory_.cleanup();
-  ObDASSyncAccessP::get_das_factory() = nullptr;
+  get_das_factory() = nullptr;
   if (das_remote_info_.trans_desc_ != nullptr) {
     MTL(transaction::ObTransService*)->release_tx(*das_remote_info_.trans_desc_);
     das_remote_info_.trans_desc_ = nullptr;
   }
-  ObDASSyncRpcProcessor::cleanup();
+  RpcProcessor::cleanup();
 }
 
+template class ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS>;
+template class ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS>;
+
 int ObDASSyncFetchP::process()
 {
   int ret = OB_SUCCESS;
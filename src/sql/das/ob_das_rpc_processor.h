@@ -28,33 +28,39 @@ namespace oceanbase
 {
 namespace sql
 {
-typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_SYNC_ACCESS> > ObDASSyncRpcProcessor;
 typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_SYNC_FETCH_RESULT> > ObDASSyncFetchResRpcProcessor;
 typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_ASYNC_ERASE_RESULT> > ObDASAsyncEraseResRpcProcessor;
 
-class ObDASSyncAccessP : public ObDASSyncRpcProcessor
+// the das factory of the access processor running on current thread,
+// the task ops and results deserialized from rpc are created by it
+OB_INLINE ObDASTaskFactory *&get_das_access_factory()
+{
+  RLOCAL_INLINE(ObDASTaskFactory*, g_das_fatory);
+  return g_das_fatory;
+}
+
+// executes a das task sent by remote controller, shared by sync and async access
+template <obrpc::ObRpcPacketCode pcode>
+class ObDASBaseAccessP : public obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<pcode> >
 {
 public:
-  ObDASSyncAccessP(const observer::ObGlobalContext &gctx)
+  typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<pcode> > RpcProcessor;
+  ObDASBaseAccessP(const observer::ObGlobalContext &gctx)
     : das_factory_(CURRENT_CONTEXT->get_arena_allocator()),
       exec_ctx_(CURRENT_CONTEXT->get_arena_allocator(), gctx.session_mgr_),
       frame_info_(CURRENT_CONTEXT->get_arena_allocator()),
       das_remote_info_()
   {
-    set_preserve_recv_data();
+    RpcProcessor::set_preserve_recv_data();
   }
 
-  virtual ~ObDASSyncAccessP() {}
+  virtual ~ObDASBaseAccessP() {}
   virtual int init();
   virtual int before_process();
   virtual int process();
   virtual int after_process(int error_code);
   virtual void cleanup() override;
-  static ObDASTaskFactory *&get_das_factory()
-  {
-    RLOCAL(ObDASTaskFactory*, g_das_fatory);
-    return g_das_fatory;
-  }
+  static ObDASTaskFactory *&get_das_factory() { return get_das_access_factory(); }
 private:
   ObDASTaskFactory das_factory_;
   ObDesExecContext exec_ctx_;
@@ -63,6 +69,24 @@ private:
   ObDASRemoteInfo das_remote_info_;
 };
 
+class ObDASSyncAccessP : public ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS>
+{
+public:
+  ObDASSyncAccessP(const observer::ObGlobalContext &gctx)
+    : ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS>(gctx)
+  {}
+  virtual ~ObDASSyncAccessP() {}
+};
+
+class ObDASAsyncAccessP : public ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS>
+{
+public:
+  ObDASAsyncAccessP(const observer::ObGlobalContext &gctx)
+    : ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS>(gctx)
+  {}
+  virtual ~ObDASAsyncAccessP() {}
+};
+
 class ObDASSyncFetchP : public ObDASSyncFetchResRpcProcessor
 {
 public:
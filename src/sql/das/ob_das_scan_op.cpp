@@ -424,7 +424,9 @@ int ObDASScanOp::decode_task_result(ObIDASTaskResult *task_result)
 
 //远程执行返回的TSC result,通过RPC回包带回给DAS Scheduler，
 //如果结果集超过一个RPC，标记RPC包为has_more，剩余结果集通过DTL传输回DAS Scheduler
-int ObDASScanOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
+int ObDASScanOp::fill_task_result(ObIDASTaskResult &task_result,
+                                  bool &has_more,
+                                  const int64_t memory_limit)
 {
   int ret = OB_SUCCESS;
   bool added = false;
@@ -454,7 +456,7 @@ int ObDASScanOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
         remain_row_cnt_ = 1;
       } else if (OB_FAIL(datum_store.try_add_row(result_output,
                                                 &eval_ctx,
-                                                 das::OB_DAS_MAX_PACKET_SIZE,
+                                                memory_limit,
                                                 added))) {
         LOG_WARN("try add row to datum store failed", K(ret));
       } else if (!added) {
@@ -494,7 +496,7 @@ int ObDASScanOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
         // simulate a datum store overflow error, send the remaining result through RPC
         has_more = true;
       } else if (OB_UNLIKELY(OB_FAIL(datum_store.try_add_batch(result_output, &eval_ctx,
-                                                      remain_row_cnt_, das::OB_DAS_MAX_PACKET_SIZE,
+                                                      remain_row_cnt_, memory_limit,
                                                       added)))) {
         LOG_WARN("try add row to datum store failed", K(ret));
       } else if (!added) {
@@ -79,7 +79,7 @@ OB_DEF_DESERIALIZE(ObDASRemoteInfo)
   int ctdef_cnt = 0;
   int rtdef_cnt = 0;
   ObEvalCtx *eval_ctx = nullptr;
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_access_factory();
 #if !defined(NDEBUG)
   CK(typeid(*exec_ctx_) == typeid(ObDesExecContext));
 #endif
@@ -252,7 +252,7 @@ OB_DEF_DESERIALIZE(ObDASTaskArg)
   ObDASOpType op_type = DAS_OP_INVALID;
   int64_t count = 0;
   ObIDASTaskOp *task_op = nullptr;
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_access_factory();
   CK(OB_NOT_NULL(das_factory));
   LST_DO_CODE(OB_UNIS_DECODE,
               timeout_ts_,
@@ -302,9 +302,8 @@ OB_DEF_SERIALIZE_SIZE(ObDASTaskArg)
 
 int ObDASTaskArg::add_task_op(ObIDASTaskOp *task_op)
 {
-  // we currently only support single task per ObDASTaskArg.
-  // TODO(roland.qk):remove this assert check after we enable DAS task aggregation.
-  OB_ASSERT(task_ops_.count() == 0);
+  // only the async access carries several task ops to the same server,
+  // the other callers get the single task op by get_task_op()
   return task_ops_.push_back(task_op);
 }
 
@@ -318,7 +317,8 @@ ObDASTaskResp::ObDASTaskResp()
   : has_more_(false),
     ctrl_svr_(),
     runner_svr_(),
-    op_results_()
+    op_results_(),
+    op_has_more_()
 {
 }
 
@@ -373,7 +373,8 @@ OB_DEF_SERIALIZE(ObDASTaskResp)
   }
   LST_DO_CODE(OB_UNIS_ENCODE,
               rcode_,
-              trans_result_);
+              trans_result_,
+              op_has_more_);
   return ret;
 }
 
@@ -401,7 +402,8 @@ OB_DEF_DESERIALIZE(ObDASTaskResp)
   }
   LST_DO_CODE(OB_UNIS_DECODE,
               rcode_,
-              trans_result_);
+              trans_result_,
+              op_has_more_);
   return ret;
 }
 
@@ -418,18 +420,22 @@ OB_DEF_SERIALIZE_SIZE(ObDASTaskResp)
   }
   LST_DO_CODE(OB_UNIS_ADD_LEN,
               rcode_,
-              trans_result_);
+              trans_result_,
+              op_has_more_);
   return len;
 }
 
 int ObDASTaskResp::add_op_result(ObIDASTaskResult *op_result)
 {
-  // we currently only support single task per ObDASTaskResp.
-  // TODO(roland.qk):remove this assert check after we enable DAS task aggregation.
-  OB_ASSERT(op_results_.count() == 0);
   return op_results_.push_back(op_result);
 }
 
+int ObDASTaskResp::add_op_has_more(bool has_more)
+{
+  has_more_ = has_more_ || has_more;
+  return op_has_more_.push_back(has_more);
+}
+
 ObIDASTaskResult *ObDASTaskResp::get_op_result()
 {
   OB_ASSERT(op_results_.count() == 1);
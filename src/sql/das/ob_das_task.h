@@ -111,11 +111,14 @@ public:
   const ObDASTabletLoc *get_tablet_loc() const { return tablet_loc_; }
   virtual int decode_task_result(ObIDASTaskResult *task_result) = 0;
   //远程执行填充第一个RPC结果，并返回是否还有剩余的RPC结果
+  //memory_limit is the byte budget of the op in the response, the rest goes to extra result
   virtual int fill_task_result(ObIDASTaskResult &task_result,
-                               bool &has_more)
+                               bool &has_more,
+                               const int64_t memory_limit)
   {
     UNUSED(task_result);
     UNUSED(has_more);
+    UNUSED(memory_limit);
     return OB_NOT_IMPLEMENT;
   }
   virtual int fill_extra_result()
@@ -280,6 +283,7 @@ public:
 
   int add_task_op(ObIDASTaskOp *task_op);
   ObIDASTaskOp *get_task_op();
+  const common::ObIArray<ObIDASTaskOp*> &get_task_ops() const { return task_ops_; }
   void set_remote_info(ObDASRemoteInfo *remote_info) { remote_info_ = remote_info; }
   ObDASRemoteInfo *get_remote_info() { return remote_info_; }
   common::ObAddr &get_runner_svr() { return runner_svr_; }
@@ -308,6 +312,7 @@ public:
   ObDASTaskResp();
   int add_op_result(ObIDASTaskResult *op_result);
   ObIDASTaskResult *get_op_result();
+  const common::ObIArray<ObIDASTaskResult*> &get_op_results() const { return op_results_; }
   void set_err_code(int err_code) { rcode_.rcode_ = err_code; }
   int get_err_code() const { return rcode_.rcode_; }
   const obrpc::ObRpcResultCode &get_rcode() const { return rcode_; }
@@ -316,6 +321,14 @@ public:
   int store_warning_msg(const common::ObWarningBuffer &wb);
   void set_has_more(bool has_more) { has_more_ = has_more; }
   bool has_more() const { return has_more_; }
+  // whether the idx-th op result has more data, a response may carry several task ops
+  int add_op_has_more(bool has_more);
+  bool op_has_more(int64_t idx) const
+  { return idx < op_has_more_.count() ? op_has_more_.at(idx) : has_more_; }
+  // the runner stops executing the following ops once the response is full,
+  // the response of an older runner carries no has_more of ops and executes the only op
+  bool is_op_executed(int64_t idx) const
+  { return op_has_more_.empty() || idx < op_has_more_.count(); }
   void set_ctrl_svr(const common::ObAddr &ctrl_svr) { ctrl_svr_ = ctrl_svr; }
   void set_runner_svr(const common::ObAddr &runner_svr) { runner_svr_ = runner_svr; }
   common::ObAddr get_runner_svr() { return runner_svr_; }
@@ -333,6 +346,7 @@ private:
   common::ObSEArray<ObIDASTaskResult*, 2> op_results_;  // 对应operation的结果信息，这是一个接口类，具体的定义由DML Service解析
   obrpc::ObRpcResultCode rcode_; //返回的错误信息
   transaction::ObTxExecResult trans_result_;
+  common::ObSEArray<bool, 2> op_has_more_; // has_more of each op result
 };
 
 template <typename T>
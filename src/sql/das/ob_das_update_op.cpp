@@ -217,9 +217,12 @@ int ObDASUpdateOp::decode_task_result(ObIDASTaskResult *task_result)
   return ret;
 }
 
-int ObDASUpdateOp::fill_task_result(ObIDASTaskResult &task_result, bool &has_more)
+int ObDASUpdateOp::fill_task_result(ObIDASTaskResult &task_result,
+                                    bool &has_more,
+                                    const int64_t memory_limit)
 {
   int ret = OB_SUCCESS;
+  UNUSED(memory_limit);
 #if !defined(NDEBUG)
   CK(typeid(task_result) == typeid(ObDASUpdateResult));
 #endif
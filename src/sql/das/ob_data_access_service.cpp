@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX SQL_DAS
 #include "observer/ob_srv_network_frame.h"
 #include "sql/das/ob_data_access_service.h"
+#include "sql/das/ob_das_async_access.h"
 #include "sql/das/ob_das_define.h"
 #include "sql/das/ob_das_extra_data.h"
 #include "sql/das/ob_das_ref.h"
@@ -270,18 +271,14 @@ int ObDataAccessService::do_local_das_task(ObDASRef &das_ref, ObDASTaskArg &task
   return ret;
 }
 
-int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &task_arg)
+int ObDataAccessService::prepare_remote_task_arg(ObDASRef &das_ref,
+                                                 ObDASTaskArg &task_arg,
+                                                 ObDASRemoteInfo &remote_info)
 {
   int ret = OB_SUCCESS;
-  void *resp_buf = nullptr;
   ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
-  ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
-  int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
-  uint64_t tenant_id = session->get_rpc_tenant_id();
-  ObIDASTaskOp *task_op = task_arg.get_task_op();
-  ObIDASTaskResult *op_result = nullptr;
-  ObDASExtraData *extra_result = nullptr;
-  ObDASRemoteInfo remote_info;
+  // the task ops of one arg are from the same das ref and read the same snapshot
+  ObIDASTaskOp *task_op = task_arg.get_task_ops().at(0);
   remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
   remote_info.frame_info_ = das_ref.get_expr_frame_info();
   remote_info.trans_desc_ = session->get_tx_desc();
@@ -289,11 +286,73 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
   remote_info.need_tx_ = (remote_info.trans_desc_ != nullptr);
   task_arg.set_remote_info(&remote_info);
   ObDASRemoteInfo::get_remote_info() = &remote_info;
+  if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
+    LOG_WARN("collect das task info failed", K(ret));
+  }
+  return ret;
+}
+
+int ObDataAccessService::process_remote_task_resp(ObDASRef &das_ref,
+                                                  ObDASTaskResp &task_resp,
+                                                  const ObIArray<ObIDASTaskOp*> &task_ops)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  const ObIArray<ObIDASTaskResult*> &op_results = task_resp.get_op_results();
+  ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
+  if (OB_FAIL(task_resp.get_err_code())) {
+    LOG_WARN("error occurring in remote das task", K(ret), K(task_ops));
+  } else if (OB_UNLIKELY(task_ops.count() != op_results.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("task ops mismatch with op results", K(ret), K(task_ops.count()),
+             K(op_results.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    ObIDASTaskOp *task_op = task_ops.at(i);
+    ObIDASTaskResult *op_result = op_results.at(i);
+    ObDASExtraData *extra_result = nullptr;
+    if (OB_ISNULL(task_op) || OB_ISNULL(op_result)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("task op or op result is null", K(ret), K(task_op), K(op_result));
+    } else if (!task_resp.is_op_executed(i)) {
+      // left by the runner because the response is full, executed alone by the caller
+    } else if (OB_FAIL(task_op->decode_task_result(op_result))) {
+      LOG_WARN("decode das task result failed", K(ret));
+    } else if (task_resp.op_has_more(i)
+                && OB_FAIL(setup_extra_result(das_ref, task_resp,
+                task_op, extra_result))) {
+      LOG_WARN("setup extra result failed", KR(ret));
+    } else if (task_resp.op_has_more(i) && OB_FAIL(op_result->link_extra_result(*extra_result))) {
+      LOG_WARN("link extra result failed", K(ret));
+    }
+  }
+  if (OB_NOT_NULL(session->get_tx_desc())) {
+    int tmp_ret = MTL(transaction::ObTransService*)
+      ->add_tx_exec_result(*session->get_tx_desc(),
+                            task_resp.get_trans_result());
+    if (tmp_ret != OB_SUCCESS) {
+      LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
+    }
+    ret = COVER_SUCC(tmp_ret);
+  }
+  return ret;
+}
+
+int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &task_arg)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
+  int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
+  uint64_t tenant_id = session->get_rpc_tenant_id();
+  ObIDASTaskOp *task_op = task_arg.get_task_op();
+  ObIDASTaskResult *op_result = nullptr;
+  ObDASRemoteInfo remote_info;
 
   LOG_DEBUG("begin to do remote das task", K(task_arg));
   SMART_VAR(ObDASTaskResp, task_resp) {
-    if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
-      LOG_WARN("collect das task info failed", K(ret));
+    if (OB_FAIL(prepare_remote_task_arg(das_ref, task_arg, remote_info))) {
+      LOG_WARN("prepare remote task arg failed", K(ret));
     } else if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op->get_type(), op_result))) {
       LOG_WARN("create das task result failed", K(ret));
     } else if (OB_FAIL(op_result->init(*task_op))) {
@@ -303,46 +362,273 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
       LOG_WARN("das is timeout", K(ret), K(plan_ctx->get_timeout_timestamp()), K(timeout));
     } else if (OB_FAIL(task_resp.add_op_result(op_result))) {
       LOG_WARN("failed to add op result", K(ret));
-    } else if (OB_FAIL(das_rpc_proxy_
-                    .to(task_arg.get_runner_svr())
-                    .by(tenant_id)
-                    .timeout(timeout)
-                    .remote_sync_access(task_arg, task_resp))) {
+    } else if (OB_FAIL(remote_sync_access(task_arg.get_runner_svr(),
+                                          tenant_id,
+                                          timeout,
+                                          task_arg,
+                                          task_resp))) {
       LOG_WARN("rpc remote sync access failed", K(ret), K(task_arg));
       // RPC fail, add task's LSID to trans_result
       // indicate some transaction participant may touched
       session->get_trans_result().add_touched_ls(task_op->get_ls_id());
+    } else if (OB_FAIL(process_remote_task_resp(das_ref, task_resp, task_arg.get_task_ops()))) {
+      LOG_WARN("process remote task resp failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+bool ObDataAccessService::can_async_access(const ObDASRef &das_ref, const ObIDASTaskOp &task_op) const
+{
+  // only the scan tasks are sent by async rpc, they read the same snapshot and
+  // have no order dependency between each other
+  return !das_ref.is_execute_directly()
+      && (DAS_OP_TABLE_SCAN == task_op.get_type() || DAS_OP_TABLE_BATCH_SCAN == task_op.get_type())
+      && OB_NOT_NULL(task_op.get_tablet_loc())
+      && task_op.get_tablet_loc()->server_ != ctrl_addr_;
+}
+
+int ObDataAccessService::execute_das_task_async(ObDASRef &das_ref,
+                                                ObDASAsyncCbMgr &cb_mgr,
+                                                const ObIArray<ObIDASTaskOp*> &task_ops)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObDASTaskArg task_arg;
+  if (OB_UNLIKELY(task_ops.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("no das task op to execute", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    if (OB_FAIL(task_arg.add_task_op(task_ops.at(i)))) {
+      LOG_WARN("failed to add das task op", K(ret), KPC(task_ops.at(i)));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    task_arg.set_timeout_ts(session->get_query_timeout_ts());
+    task_arg.set_ctrl_svr(ctrl_addr_);
+    task_arg.get_runner_svr() = task_ops.at(0)->tablet_loc_->server_;
+    if (OB_FAIL(do_async_remote_das_task(das_ref, cb_mgr, task_arg))) {
+      LOG_WARN("do async remote das task failed", K(ret), K(task_ops));
+    }
+  }
+  for (int64_t i = 0; i < task_ops.count(); ++i) {
+    task_ops.at(i)->errcode_ = ret;
+  }
+  return ret;
+}
+
+int ObDataAccessService::do_async_remote_das_task(ObDASRef &das_ref,
+                                                  ObDASAsyncCbMgr &cb_mgr,
+                                                  ObDASTaskArg &task_arg)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
+  int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
+  uint64_t tenant_id = session->get_rpc_tenant_id();
+  const ObIArray<ObIDASTaskOp*> &task_ops = task_arg.get_task_ops();
+  ObDASAsyncAccessCB *cb = nullptr;
+  const ObCurTraceId::TraceId *trace_id = ObCurTraceId::get_trace_id();
+  ObDASRemoteInfo remote_info;
+
+  LOG_DEBUG("begin to do async remote das task", K(task_arg));
+  if (OB_ISNULL(trace_id)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("trace id is null", K(ret));
+  } else if (OB_UNLIKELY(timeout <= 0)) {
+    ret = OB_TIMEOUT;
+    LOG_WARN("das is timeout", K(ret), K(plan_ctx->get_timeout_timestamp()), K(timeout));
+  } else if (OB_FAIL(prepare_remote_task_arg(das_ref, task_arg, remote_info))) {
+    LOG_WARN("prepare remote task arg failed", K(ret));
+  } else if (OB_ISNULL(buf = das_ref.get_das_alloc().alloc(sizeof(ObDASAsyncAccessCB)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate das async access callback failed", K(ret));
+  } else {
+    cb = new (buf) ObDASAsyncAccessCB(cb_mgr, *trace_id);
+    // the results are decoded by rpc thread in the order of task ops
+    for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+      ObIDASTaskOp *task_op = task_ops.at(i);
+      ObIDASTaskResult *op_result = nullptr;
+      if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op->get_type(), op_result))) {
+        LOG_WARN("create das task result failed", K(ret));
+      } else if (OB_FAIL(op_result->init(*task_op))) {
+        LOG_WARN("init task result failed", K(ret));
+      } else if (OB_FAIL(cb->get_task_resp().add_op_result(op_result))) {
+        LOG_WARN("failed to add op result", K(ret));
+      } else if (OB_FAIL(cb->add_task_op(task_op))) {
+        LOG_WARN("failed to add task op", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      cb->~ObDASAsyncAccessCB();
+    } else if (OB_FAIL(cb_mgr.add_cb(cb))) {
+      LOG_WARN("add das async access callback failed", K(ret));
+      cb->~ObDASAsyncAccessCB();
+    } else if (OB_FAIL(remote_async_access(task_arg.get_runner_svr(),
+                                           tenant_id,
+                                           timeout,
+                                           task_arg,
+                                           cb))) {
+      LOG_WARN("rpc remote async access failed", K(ret), K(task_arg));
+      // the callback will never be called if post failed
+      cb_mgr.get_cb_list().pop_back();
+      cb->~ObDASAsyncAccessCB();
+      for (int64_t i = 0; i < task_ops.count(); ++i) {
+        session->get_trans_result().add_touched_ls(task_ops.at(i)->get_ls_id());
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::collect_async_das_task(ObDASRef &das_ref, ObDASAsyncAccessCB &cb)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  const ObIArray<ObIDASTaskOp*> &task_ops = cb.get_task_ops();
+  ObDASTaskResp &task_resp = cb.get_task_resp();
+  int resp_ret = OB_SUCCESS;
+  if (OB_SUCCESS != (resp_ret = cb.get_rpc_ret())) {
+    LOG_WARN("rpc remote async access failed", K(resp_ret), K(cb));
+    // indicate some transaction participant may touched
+    for (int64_t i = 0; i < task_ops.count(); ++i) {
+      session->get_trans_result().add_touched_ls(task_ops.at(i)->get_ls_id());
+    }
+  } else if (OB_SUCCESS != (resp_ret = process_remote_task_resp(das_ref, task_resp, task_ops))) {
+    LOG_WARN("process remote task resp failed", K(resp_ret));
+  }
+  // the tasks sent together share the result of the response, each of them is retried alone
+  for (int64_t i = 0; i < task_ops.count(); ++i) {
+    task_ops.at(i)->errcode_ = resp_ret;
+  }
+  ret = resp_ret;
+  if (OB_FAIL(ret) && GCONF._enable_partition_level_retry) {
+    ret = OB_SUCCESS;
+    for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+      ObIDASTaskOp &task_op = *task_ops.at(i);
+      int tmp_ret = OB_SUCCESS;
+      if (!task_op.can_part_retry()) {
+        ret = resp_ret;
+      } else if (OB_SUCCESS != (tmp_ret = retry_das_task(das_ref, task_op))) {
+        //retry by sync rpc, same as execute_das_task
+        LOG_WARN("failed to retry das task", K(tmp_ret));
+        ret = resp_ret;
+      }
+    }
+  }
+  // the runner stops coalescing once the response is full, the rest task ops are sent alone
+  for (int64_t i = 0; OB_SUCC(ret) && OB_SUCCESS == resp_ret && i < task_ops.count(); ++i) {
+    if (!task_resp.is_op_executed(i) && OB_FAIL(execute_das_task(das_ref, *task_ops.at(i)))) {
+      LOG_WARN("execute das task left by the runner failed", K(ret), KPC(task_ops.at(i)));
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::remote_sync_access(const ObAddr &runner_svr,
+                                            const uint64_t tenant_id,
+                                            const int64_t timeout,
+                                            const ObDASTaskArg &task_arg,
+                                            ObDASTaskResp &task_resp)
+{
+  return das_rpc_proxy_.to(runner_svr)
+                       .by(tenant_id)
+                       .timeout(timeout)
+                       .remote_sync_access(task_arg, task_resp);
+}
+
+int ObDataAccessService::remote_async_access(const ObAddr &runner_svr,
+                                             const uint64_t tenant_id,
+                                             const int64_t timeout,
+                                             const ObDASTaskArg &task_arg,
+                                             ObDASAsyncAccessCB *cb)
+{
+  return das_rpc_proxy_.to(runner_svr)
+                       .by(tenant_id)
+                       .timeout(timeout)
+                       .remote_async_access(task_arg, cb);
+}
+
+int ObDataAccessService::execute_remote_task_ops(const ObIArray<ObIDASTaskOp*> &task_ops,
+                                                 ObDASTaskResp &task_resp,
+                                                 int64_t &executed_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObIDASTaskResult*> &task_results = task_resp.get_op_results();
+  executed_cnt = 0;
+  if (OB_UNLIKELY(task_ops.empty() || task_ops.count() != task_results.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("task ops mismatch with task results", K(ret), K(task_ops.count()),
+             K(task_results.count()));
+  }
+  // the first failure is returned for the whole response, the following task ops are skipped.
+  // each op is given the byte budget left by the ops before it, the ops after the budget is
+  // used up are not executed here and the controller executes them alone
+  int64_t remain_size = das::OB_DAS_MAX_PACKET_SIZE;
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count() && remain_size > 0; ++i) {
+    ObIDASTaskOp *task_op = task_ops.at(i);
+    ObIDASTaskResult *task_result = task_results.at(i);
+    bool has_more = false;
+    if (OB_ISNULL(task_op) || OB_ISNULL(task_result)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("task op is nullptr", K(ret), K(task_op), K(task_result));
     } else {
-      ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
-      if (OB_FAIL(task_resp.get_err_code())) {
-        LOG_WARN("error occurring in remote das task", K(ret), K(task_arg));
-      } else if (OB_FAIL(task_op->decode_task_result(op_result))) {
-        LOG_WARN("decode das task result failed", K(ret));
-      } else if (task_resp.has_more()
-                  && OB_FAIL(setup_extra_result(das_ref, task_resp,
-                  task_op, extra_result))) {
-        LOG_WARN("setup extra result failed", KR(ret));
-      } else if (task_resp.has_more() && OB_FAIL(op_result->link_extra_result(*extra_result))) {
-        LOG_WARN("link extra result failed", K(ret));
+      ++executed_cnt;
+      //regardless of the success of the task execution, the fllowing meta info must be set
+      task_result->set_task_id(task_op->get_task_id());
+      if (OB_FAIL(task_op->start_das_task())) {
+        LOG_WARN("start das task failed", K(ret));
+      } else if (OB_FAIL(task_op->fill_task_result(*task_result, has_more, remain_size))) {
+        LOG_WARN("fill task result to controller failed", K(ret));
+      } else if (OB_UNLIKELY(has_more) && OB_FAIL(task_op->fill_extra_result())) {
+        LOG_WARN("fill extra result to controller failed", KR(ret));
+      } else if (OB_FAIL(task_resp.add_op_has_more(has_more))) {
+        LOG_WARN("add op has more failed", K(ret));
+      } else {
+        // the op may exceed its budget by the last row or batch it added,
+        // the ops after it are left to the controller then
+        const int64_t result_size = task_result->get_serialize_size();
+        remain_size = result_size >= remain_size ? 0 : remain_size - result_size;
       }
-      if (OB_NOT_NULL(session->get_tx_desc())) {
-        int tmp_ret = MTL(transaction::ObTransService*)
-          ->add_tx_exec_result(*session->get_tx_desc(),
-                                task_resp.get_trans_result());
-        if (tmp_ret != OB_SUCCESS) {
-          LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
-        }
-        ret = COVER_SUCC(tmp_ret);
+      //因为end_task还有可能失败，需要通过RPC将end_task的返回值带回到scheduler上
+      int tmp_ret = task_op->end_das_task();
+      if (OB_SUCCESS != tmp_ret) {
+        LOG_WARN("end das task failed", K(ret), K(tmp_ret));
       }
+      ret = COVER_SUCC(tmp_ret);
     }
   }
   return ret;
 }
 
+void ObDataAccessService::erase_remote_task_results(const ObIArray<ObIDASTaskOp*> &task_ops,
+                                                    const int64_t executed_cnt)
+{
+  for (int64_t i = 0; i < executed_cnt && i < task_ops.count(); ++i) {
+    int tmp_ret = task_result_mgr_.erase_task_result(task_ops.at(i)->get_task_id());
+    if (OB_SUCCESS != tmp_ret) {
+      LOG_WARN("erase task result failed", K(tmp_ret), K(task_ops.at(i)->get_task_id()));
+    }
+  }
+}
+
 int ObDataAccessService::collect_das_task_info(ObDASTaskArg &task_arg, ObDASRemoteInfo &remote_info)
 {
   int ret = OB_SUCCESS;
-  ObIDASTaskOp *task_op = task_arg.get_task_op();
+  const ObIArray<ObIDASTaskOp*> &task_ops = task_arg.get_task_ops();
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    if (OB_FAIL(collect_das_task_op_info(task_ops.at(i), remote_info))) {
+      LOG_WARN("collect das task op info failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::collect_das_task_op_info(ObIDASTaskOp *task_op, ObDASRemoteInfo &remote_info)
+{
+  int ret = OB_SUCCESS;
   if (task_op->get_ctdef() != nullptr) {
     remote_info.has_expr_ |= task_op->get_ctdef()->has_expr();
     remote_info.need_calc_expr_ |= task_op->get_ctdef()->has_pdfilter_or_calc_expr();
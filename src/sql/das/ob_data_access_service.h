@@ -25,14 +25,20 @@ class ObDASTaskArg;
 class ObDASTaskResp;
 class ObPhyTableLocation;
 class ObDASExtraData;
+class ObDASAsyncCbMgr;
+class ObDASAsyncAccessCB;
 class ObDataAccessService
 {
+public:
+  // limits the task count of one rpc, the runner also stops executing the coalesced tasks
+  // once the response reaches das::OB_DAS_MAX_PACKET_SIZE
+  static const int64_t MAX_ASYNC_TASK_CNT_PER_RPC = 16;
 public:
   ObDataAccessService()
     : das_rpc_proxy_(),
       ctrl_addr_()
   { }
-  ~ObDataAccessService() = default;
+  virtual ~ObDataAccessService() = default;
   static int mtl_init(ObDataAccessService* &das);
   static void mtl_destroy(ObDataAccessService* &das);
   int init(rpc::frame::ObReqTransport *transport,
@@ -41,11 +47,39 @@ public:
   int execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   //关闭DAS Task的执行流程，并释放task持有的资源，并结束相关的事务控制
   int end_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  //remote scan task can be sent by async rpc, the worker does not wait for it here
+  bool can_async_access(const ObDASRef &das_ref, const ObIDASTaskOp &task_op) const;
+  //the task ops to the same server are sent by one rpc, the result of them is consumed by
+  //collect_async_das_task after cb_mgr finished waiting
+  int execute_das_task_async(ObDASRef &das_ref,
+                             ObDASAsyncCbMgr &cb_mgr,
+                             const common::ObIArray<ObIDASTaskOp*> &task_ops);
+  int collect_async_das_task(ObDASRef &das_ref, ObDASAsyncAccessCB &cb);
+  //executes the task ops sent by a remote controller in the order of task_resp op results,
+  //executed_cnt is the count of the task ops executed here
+  int execute_remote_task_ops(const common::ObIArray<ObIDASTaskOp*> &task_ops,
+                              ObDASTaskResp &task_resp,
+                              int64_t &executed_cnt);
+  //the extra results of the executed task ops are never fetched once the response failed
+  void erase_remote_task_results(const common::ObIArray<ObIDASTaskOp*> &task_ops,
+                                 const int64_t executed_cnt);
   int get_das_task_id(int64_t &das_id);
   int rescan_das_task(ObDASRef &das_ref, ObDASScanOp &scan_op);
   obrpc::ObDASRpcProxy &get_rpc_proxy() { return das_rpc_proxy_; }
   ObDASTaskResultMgr &get_task_res_mgr() { return task_result_mgr_; }
   static ObDataAccessService &get_instance();
+protected:
+  //send the das task arg to the runner, overridden by unittest to simulate the remote server
+  virtual int remote_sync_access(const common::ObAddr &runner_svr,
+                                 const uint64_t tenant_id,
+                                 const int64_t timeout,
+                                 const ObDASTaskArg &task_arg,
+                                 ObDASTaskResp &task_resp);
+  virtual int remote_async_access(const common::ObAddr &runner_svr,
+                                  const uint64_t tenant_id,
+                                  const int64_t timeout,
+                                  const ObDASTaskArg &task_arg,
+                                  ObDASAsyncAccessCB *cb);
 private:
   int execute_dist_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int clear_task_exec_env(ObDASRef &das_ref, ObIDASTaskOp &task_op);
@@ -53,11 +87,17 @@ private:
   int retry_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int do_local_das_task(ObDASRef &das_ref, ObDASTaskArg &task_arg);
   int do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &das_task);
+  int do_async_remote_das_task(ObDASRef &das_ref, ObDASAsyncCbMgr &cb_mgr, ObDASTaskArg &task_arg);
+  int prepare_remote_task_arg(ObDASRef &das_ref, ObDASTaskArg &task_arg, ObDASRemoteInfo &remote_info);
+  int process_remote_task_resp(ObDASRef &das_ref,
+                               ObDASTaskResp &task_resp,
+                               const common::ObIArray<ObIDASTaskOp*> &task_ops);
   int setup_extra_result(ObDASRef &das_ref,
                          ObDASTaskResp &task_resp,
                          ObIDASTaskOp *task_op,
                          ObDASExtraData *&extra_result);
   int collect_das_task_info(ObDASTaskArg &task_arg, ObDASRemoteInfo &remote_info);
+  int collect_das_task_op_info(ObIDASTaskOp *task_op, ObDASRemoteInfo &remote_info);
   bool can_fast_fail(const ObIDASTaskOp &task_op) const;
 private:
   obrpc::ObDASRpcProxy das_rpc_proxy_;
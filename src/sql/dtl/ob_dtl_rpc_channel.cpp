@@ -22,6 +22,7 @@
 #include "sql/dtl/ob_dtl_channel_agent.h"
 #include "share/rc/ob_context.h"
 #include "sql/dtl/ob_dtl_channel_watcher.h"
+#include "lib/compress/ob_compressor_pool.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::share;
@@ -168,7 +169,8 @@ ObDtlRpcChannel::ObDtlRpcChannel(
     const uint64_t tenant_id,
     const uint64_t id,
     const ObAddr &peer)
-    : ObDtlBasicChannel(tenant_id, id, peer), recv_mock_eof_cnt_(0)
+    : ObDtlBasicChannel(tenant_id, id, peer), recv_mock_eof_cnt_(0), send_data_msg_cnt_(0),
+      skip_compress_data_(false)
 {}
 
 ObDtlRpcChannel::ObDtlRpcChannel(
@@ -176,7 +178,8 @@ ObDtlRpcChannel::ObDtlRpcChannel(
     const uint64_t id,
     const ObAddr &peer,
     const int64_t hash_val)
-    : ObDtlBasicChannel(tenant_id, id, peer, hash_val), recv_mock_eof_cnt_(0)
+    : ObDtlBasicChannel(tenant_id, id, peer, hash_val), recv_mock_eof_cnt_(0),
+      send_data_msg_cnt_(0), skip_compress_data_(false)
 {}
 
 ObDtlRpcChannel::~ObDtlRpcChannel()
@@ -312,7 +315,7 @@ int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
     } else if (OB_FAIL(msg_response_.start())) {
       LOG_WARN("start message process fail", K(ret));
     } else if (OB_FAIL(DTL.get_rpc_proxy().to(peer_).timeout(timeout_us)
-        .compressed(compressor_type_)
+        .compressed(get_msg_compressor_type(*buf))
         .ap_send_message(ObDtlSendArgs{peer_id_, *buf}, &cb))) {
       LOG_WARN("send message failed", K_(peer), K(ret));
       int tmp_ret = msg_response_.on_start_fail();
@@ -339,6 +342,68 @@ int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
   return ret;
 }
 
+ObCompressorType ObDtlRpcChannel::get_msg_compressor_type(const ObDtlLinkedBuffer &buf)
+{
+  int ret = OB_SUCCESS;
+  ObCompressorType type = compressor_type_;
+  if (ObCompressorType::NONE_COMPRESSOR == compressor_type_ || !buf.is_data_msg()) {
+    // control messages are small, keep the configured compression
+  } else {
+    if (0 == send_data_msg_cnt_ % COMPRESS_SAMPLE_INTERVAL) {
+      bool worth_compress = true;
+      if (OB_FAIL(sample_compress_ratio(buf, worth_compress))) {
+        LOG_WARN("failed to sample compress ratio", K(ret));
+        worth_compress = true;
+      }
+      skip_compress_data_ = !worth_compress;
+    }
+    ++send_data_msg_cnt_;
+    if (skip_compress_data_) {
+      type = ObCompressorType::NONE_COMPRESSOR;
+    }
+  }
+  return type;
+}
+
+int ObDtlRpcChannel::sample_compress_ratio(const ObDtlLinkedBuffer &buf, bool &worth_compress)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  int64_t compressed_size = 0;
+  worth_compress = true;
+  if (buf.size() <= 0) {
+    // do nothing
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type_,
+                                                                     compressor))) {
+    LOG_WARN("failed to get compressor", K(ret), K_(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(buf.size(), max_overflow_size))) {
+    LOG_WARN("failed to get max overflow size", K(ret));
+  } else {
+    // the sample buffer is freed at once, channels may stay idle for a long time
+    // and there are lots of them in a big px plan
+    const int64_t compress_buf_size = buf.size() + max_overflow_size;
+    char *compress_buf = NULL;
+    if (OB_ISNULL(compress_buf = static_cast<char *>(
+                  ob_malloc(compress_buf_size, ObMemAttr(tenant_id_, "DtlCompress"))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc compress buffer", K(ret), K(compress_buf_size));
+    } else if (OB_FAIL(compressor->compress(buf.buf(), buf.size(), compress_buf,
+                                            compress_buf_size, compressed_size))) {
+      LOG_WARN("failed to compress", K(ret), K(buf.size()));
+    } else {
+      worth_compress = compressed_size * 100 < buf.size() * COMPRESS_WORTH_PERCENT;
+      LOG_TRACE("sample dtl compress ratio", K(buf.size()), K(compressed_size),
+                K(worth_compress), K_(peer));
+    }
+    if (OB_NOT_NULL(compress_buf)) {
+      ob_free(compress_buf);
+      compress_buf = NULL;
+    }
+  }
+  return ret;
+}
+
 }  // dtl
 }  // sql
 }  // oceanbase
@@ -100,7 +100,18 @@ public:
   virtual int send_message(ObDtlLinkedBuffer *&buf);
 
 private:
+  // Data buffers of some plans hardly compress (e.g. already compressed or random strings),
+  // compress one of every COMPRESS_SAMPLE_INTERVAL data buffers locally to measure the ratio
+  // and send data buffers of the channel uncompressed while it is not worth it.
+  common::ObCompressorType get_msg_compressor_type(const ObDtlLinkedBuffer &buf);
+  int sample_compress_ratio(const ObDtlLinkedBuffer &buf, bool &worth_compress);
+private:
+  static const int64_t COMPRESS_SAMPLE_INTERVAL = 64;
+  // compressed size should be less than 90% of the original size
+  static const int64_t COMPRESS_WORTH_PERCENT = 90;
   int64_t recv_mock_eof_cnt_;
+  int64_t send_data_msg_cnt_;
+  bool skip_compress_data_;
 };
 
 }  // dtl
@@ -60,6 +60,14 @@ void ObAdaptiveByPassCtrl::gby_process_state(int64_t probe_cnt, int64_t row_cnt,
       // distinct rate is not good
       // prepare to release curr hash table
       state_ = STATE_PROCESS_HT;
+      // the worse the observed reduction, the fewer rounds are tried before by pass.
+      // rows without any duplicate add MAX_REBUILD_TIMES / 2 = 2 here on top of the 1
+      // added when the next round starts, so rebuild_times_ is 2, 5, 8 after analyzing
+      // round 1, 2, 3 and exceeds MAX_REBUILD_TIMES in round 3 instead of round 7,
+      // a reduction close to the threshold adds nothing and keeps the 7 rounds.
+      double threshold = 1 - (1 / static_cast<double> (cut_ratio_));
+      double reduction = static_cast<double> (exists_cnt_) / probe_cnt_;
+      rebuild_times_ += static_cast<int64_t> ((1 - reduction / threshold) * MAX_REBUILD_TIMES / 2);
     }
     LOG_TRACE("get new state", K(state_), K(processed_cnt_), K(exists_cnt_),
                               K(probe_cnt_), K(rebuild_times_), K(cut_ratio_), K(mem_size), K(op_id_));
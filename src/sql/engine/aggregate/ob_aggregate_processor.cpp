@@ -3633,7 +3633,9 @@ int ObAggregateProcessor::max_calc(AggrCell &aggr_cell, ObDatum &base, const ObD
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("cmp_func is NULL", K(ret));
   } else if (!base.is_null() && !other.is_null()) {
-    if (cmp_func(base, other) < 0) {
+    const int cmp = cmp_func(base, other);
+    if (cmp < 0 || (0 == cmp && removal_info_.keep_last_extremum_
+                     && ObDatum::binary_equal(base, other))) {
       ret = clone_aggr_cell(aggr_cell, other, is_number);
       removal_info_.is_index_change_ = true;
     }
@@ -3656,7 +3658,9 @@ int ObAggregateProcessor::min_calc(AggrCell &aggr_cell, ObDatum &base, const ObD
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("cmp_func is NULL", K(ret));
   } else if (!base.is_null() && !other.is_null()) {
-    if (cmp_func(base, other) > 0) {
+    const int cmp = cmp_func(base, other);
+    if (cmp > 0 || (0 == cmp && removal_info_.keep_last_extremum_
+                     && ObDatum::binary_equal(base, other))) {
       ret = clone_aggr_cell(aggr_cell, other, is_number);
       removal_info_.is_index_change_ = true;
     }
@@ -42,7 +42,8 @@ struct RemovalInfo
       is_index_change_(false),
       is_inv_aggr_(false),
       null_cnt_(0),
-      is_out_of_range_(false)
+      is_out_of_range_(false),
+      keep_last_extremum_(false)
   {
   }
   ~RemovalInfo() {}
@@ -59,12 +60,16 @@ struct RemovalInfo
       is_index_change_ = false;
     }
   }
-  TO_STRING_KV(K_(max_min_index), K_(is_index_change), K_(is_inv_aggr));
+  TO_STRING_KV(K_(max_min_index), K_(is_index_change), K_(is_inv_aggr), K_(keep_last_extremum));
   int64_t max_min_index_; // extreme index position
   bool is_index_change_;  // whether the extreme value index position changes
   bool is_inv_aggr_;      // whether the aggregate function support single line inverse
   int64_t null_cnt_;      // count of null in frame for calculating sum
   bool is_out_of_range_;  // whether out of range when calculateing
+  // take the later one of binary equal extremums, which stays longer in a sliding frame.
+  // extremums only equal under the collation (e.g. 'a' and 'A') keep the first one.
+  // it is set by window function and kept by reset()
+  bool keep_last_extremum_;
 };
 
 struct ObAggrInfo
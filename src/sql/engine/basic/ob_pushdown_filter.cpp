@@ -14,6 +14,7 @@
 #include "ob_pushdown_filter.h"
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/engine/ob_exec_context.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
@@ -1067,6 +1068,27 @@ int ObBlackFilterExecutor::filter(ObEvalCtx &eval_ctx, bool &filtered)
   return ret;
 }
 
+int ObBlackFilterExecutor::check_filter_bypass(const int64_t row_cnt, bool &is_bypass)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx &eval_ctx = op_.get_eval_ctx();
+  is_bypass = !filter_.filter_exprs_.empty();
+  FOREACH_CNT_X(e, filter_.filter_exprs_, is_bypass) {
+    is_bypass = (T_OP_JOIN_BLOOM_FILTER == (*e)->type_);
+  }
+  FOREACH_CNT_X(e, filter_.filter_exprs_, OB_SUCC(ret) && is_bypass) {
+    if (OB_FAIL(ObExprJoinFilter::check_bypass(**e, eval_ctx, is_bypass))) {
+      LOG_WARN("failed to check join filter bypass", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && is_bypass) {
+    FOREACH_CNT(e, filter_.filter_exprs_) {
+      ObExprJoinFilter::add_bypass_rows(**e, eval_ctx, row_cnt);
+    }
+  }
+  return ret;
+}
+
 // 提供给存储如果发现是黑盒filter，则调用该接口来判断是否被过滤掉
 int ObBlackFilterExecutor::filter(ObObj *objs, int64_t col_cnt, bool &filtered)
 {
@@ -409,6 +409,9 @@ public:
                    const int64_t end,
                    common::ObBitmap &result_bitmap);
   int get_datums_from_column(common::ObIArray<common::ObDatum *> &datums);
+  // true if the filter consists of runtime join filters which let all rows pass for now,
+  // storage sets the result of @row_cnt rows without decoding the filter columns then
+  int check_filter_bypass(const int64_t row_cnt, bool &is_bypass);
   INHERIT_TO_STRING_KV("ObPushdownBlackFilterExecutor", ObPushdownFilterExecutor,
                        K_(filter), K_(n_eval_infos),
                        KP_(eval_infos), KP_(skip_bit));
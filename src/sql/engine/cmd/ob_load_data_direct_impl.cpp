@@ -0,0 +1,1072 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/cmd/ob_load_data_direct_impl.h"
+#include "lib/mysqlclient/ob_mysql_proxy.h"
+#include "lib/mysqlclient/ob_mysql_result.h"
+#include "lib/oblog/ob_log_module.h"
+#include "lib/string/ob_sql_string.h"
+#include "observer/ob_inner_sql_connection.h"
+#include "observer/ob_server_struct.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/location_cache/ob_location_service.h"
+#include "share/ob_autoincrement_service.h"
+#include "share/ob_max_id_fetcher.h"
+#include "share/object/ob_obj_cast.h"
+#include "share/rc/ob_tenant_base.h"
+#include "share/schema/ob_table_schema.h"
+#include "storage/tx/ob_ts_mgr.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#include "sql/engine/cmd/ob_load_data_utils.h"
+#include "sql/ob_sql_utils.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace share::schema;
+using namespace storage;
+using namespace blocksstable;
+
+namespace sql
+{
+
+/**
+ * RowCompare
+ */
+
+bool ObLoadDataDirectImpl::RowCompare::operator()(const ObNewRow *left, const ObNewRow *right)
+{
+  int ret = OB_SUCCESS;
+  int cmp = 0;
+  if (OB_FAIL(result_code_)) {
+    // do nothing
+  } else if (OB_ISNULL(left) || OB_ISNULL(right)
+      || OB_UNLIKELY(left->get_count() < rowkey_column_num_ || right->get_count() < rowkey_column_num_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KPC(left), KPC(right), K_(rowkey_column_num));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && 0 == cmp && i < rowkey_column_num_; ++i) {
+      if (OB_FAIL(left->get_cell(i).compare(right->get_cell(i), cmp))) {
+        LOG_WARN("fail to compare rowkey cell", K(ret), K(i), KPC(left), KPC(right));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    result_code_ = ret;
+  }
+  return cmp < 0;
+}
+
+/**
+ * RowIterator
+ */
+
+ObLoadDataDirectImpl::RowIterator::RowIterator()
+  : sorter_(nullptr), tablet_id_(), current_row_(), rowkey_allocator_("TLD_LastRowkey"),
+    last_rowkey_(), row_count_(0)
+{
+}
+
+int ObLoadDataDirectImpl::RowIterator::init(ObIAllocator &allocator,
+                                            ExternalSort &sorter,
+                                            const ObTabletID &tablet_id,
+                                            const int64_t column_count)
+{
+  int ret = OB_SUCCESS;
+  const int64_t request_cnt = column_count + ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  ObObj *cells = nullptr;
+  if (OB_UNLIKELY(!tablet_id.is_valid() || column_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(tablet_id), K(column_count));
+  } else if (OB_ISNULL(cells = static_cast<ObObj *>(allocator.alloc(sizeof(ObObj) * request_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(request_cnt));
+  } else {
+    new (cells) ObObj[request_cnt];
+    current_row_.cells_ = cells;
+    current_row_.count_ = request_cnt;
+    sorter_ = &sorter;
+    tablet_id_ = tablet_id;
+    last_rowkey_.reset();
+    row_count_ = 0;
+  }
+  return ret;
+}
+
+void ObLoadDataDirectImpl::RowIterator::reset()
+{
+  sorter_ = nullptr;
+  tablet_id_.reset();
+  current_row_.reset();
+  last_rowkey_.reset();
+  rowkey_allocator_.reset();
+  row_count_ = 0;
+}
+
+int ObLoadDataDirectImpl::RowIterator::get_next_row(ObNewRow *&row)
+{
+  UNUSEDx(row);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObLoadDataDirectImpl::RowIterator::get_next_row_with_tablet_id(
+    const uint64_t table_id,
+    const int64_t rowkey_count,
+    const int64_t snapshot_version,
+    ObNewRow *&row,
+    ObTabletID &tablet_id)
+{
+  UNUSED(table_id);
+  int ret = OB_SUCCESS;
+  const ObNewRow *sorted_row = nullptr;
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  if (OB_ISNULL(sorter_) || OB_UNLIKELY(0 >= snapshot_version)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("row iterator not init", K(ret), KP(sorter_), K(snapshot_version));
+  } else if (OB_FAIL(sorter_->get_next_item(sorted_row))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("fail to get next sorted row", K(ret));
+    }
+  } else if (OB_ISNULL(sorted_row)
+      || OB_UNLIKELY(sorted_row->get_count() + extra_rowkey_cnt != current_row_.get_count()
+                     || rowkey_count > sorted_row->get_count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected sorted row", K(ret), KPC(sorted_row), K(rowkey_count), K(current_row_.get_count()));
+  } else if (OB_FAIL(check_rowkey_duplicated(*sorted_row, rowkey_count))) {
+    LOG_WARN("fail to check rowkey duplicated", K(ret), KPC(sorted_row));
+  } else {
+    for (int64_t i = 0; i < sorted_row->get_count(); ++i) {
+      if (i < rowkey_count) {
+        current_row_.cells_[i] = sorted_row->cells_[i];
+      } else {
+        current_row_.cells_[i + extra_rowkey_cnt] = sorted_row->cells_[i];
+      }
+    }
+    // add extra rowkey
+    current_row_.cells_[rowkey_count].set_int(-snapshot_version);
+    current_row_.cells_[rowkey_count + 1].set_int(0);
+    row = &current_row_;
+    tablet_id = tablet_id_;
+    ++row_count_;
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::RowIterator::check_rowkey_duplicated(const ObNewRow &row,
+                                                               const int64_t rowkey_count)
+{
+  int ret = OB_SUCCESS;
+  const ObRowkey rowkey(row.cells_, rowkey_count);
+  int cmp = 1;
+  if (last_rowkey_.is_valid() && OB_FAIL(rowkey.compare(last_rowkey_, cmp))) {
+    LOG_WARN("fail to compare rowkey", K(ret), K(rowkey), K_(last_rowkey));
+  } else if (OB_UNLIKELY(0 == cmp)) {
+    // the macro block writer would fail with OB_ROWKEY_ORDER_ERROR, report what the user did
+    ret = OB_ERR_PRIMARY_KEY_DUPLICATE;
+    char rowkey_buffer[OB_TMP_BUF_SIZE_256];
+    int64_t pos = 0;
+    bool is_truncated = false;
+    for (int64_t i = 0; !is_truncated && i < rowkey_count; ++i) {
+      is_truncated = (i > 0 && OB_SUCCESS != databuff_printf(rowkey_buffer,
+                                                             OB_TMP_BUF_SIZE_256 - 1, pos, "-"))
+          || OB_SUCCESS != row.cells_[i].print_plain_str_literal(rowkey_buffer,
+                                                                 OB_TMP_BUF_SIZE_256 - 1, pos);
+    }
+    rowkey_buffer[pos] = '\0';
+    LOG_WARN("duplicated rowkey in load data file", K(ret), K(rowkey));
+    LOG_USER_ERROR(OB_ERR_PRIMARY_KEY_DUPLICATE, rowkey_buffer,
+                   static_cast<int>(sizeof("PRIMARY") - 1), "PRIMARY");
+  } else {
+    // the sorted row is only valid until the next row is got from the sorter
+    rowkey_allocator_.reuse();
+    if (OB_FAIL(rowkey.deep_copy(last_rowkey_, rowkey_allocator_))) {
+      LOG_WARN("fail to deep copy rowkey", K(ret), K(rowkey));
+    }
+  }
+  return ret;
+}
+
+/**
+ * ParseThreadPool
+ */
+
+void ObLoadDataDirectImpl::ParseThreadPool::run1()
+{
+  const int64_t worker_idx = get_thread_idx();
+  impl_.worker_rets_[worker_idx] = impl_.parse_and_sort(worker_idx);
+}
+
+/**
+ * ObLoadDataDirectImpl
+ */
+
+ObLoadDataDirectImpl::ObLoadDataDirectImpl()
+  : is_inited_(false),
+    allocator_("TLD_DirectLoad"),
+    read_mutex_(),
+    tenant_id_(OB_INVALID_TENANT_ID),
+    table_id_(OB_INVALID_ID),
+    schema_version_(0),
+    ls_id_(),
+    tablet_id_(),
+    rowkey_column_num_(0),
+    ignore_rows_(0),
+    parallel_(0),
+    expire_ts_(0),
+    file_cs_type_(CS_TYPE_INVALID),
+    compat_mode_(lib::Worker::CompatMode::MYSQL),
+    dtc_params_(),
+    cast_mode_(CM_NONE),
+    column_infos_(),
+    autoinc_param_(),
+    need_fall_back_(false),
+    workers_(nullptr),
+    merge_sort_ret_(OB_SUCCESS),
+    merge_compare_(merge_sort_ret_)
+{
+  for (int64_t i = 0; i < MAX_PARALLEL_THREAD_COUNT; ++i) {
+    worker_rets_[i] = OB_SUCCESS;
+  }
+}
+
+ObLoadDataDirectImpl::~ObLoadDataDirectImpl()
+{
+  release_resources();
+}
+
+int ObLoadDataDirectImpl::check_supported(ObExecContext &ctx,
+                                          ObLoadDataStmt &load_stmt,
+                                          bool &is_supported)
+{
+  int ret = OB_SUCCESS;
+  const ObLoadArgument &load_args = load_stmt.get_load_arguments();
+  const ObTableSchema *table_schema = nullptr;
+  const char *reason = nullptr;
+  is_supported = false;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(load_args.tenant_id_));
+    is_supported = tenant_config.is_valid() && tenant_config->_enable_load_data_direct_path;
+  }
+  if (!is_supported) {
+    // direct path is disabled
+  } else if (PARTITION_LEVEL_ZERO != load_args.part_level_) {
+    reason = "partitioned table";
+  } else if (ObLoadFileLocation::SERVER_DISK != load_args.load_file_storage_) {
+    reason = "file not on server disk";
+  } else if (ObLoadDupActionType::LOAD_STOP_ON_DUP != load_args.dupl_action_) {
+    reason = "replace or ignore duplicated rows";
+  } else if (load_stmt.get_table_assignment().count() > 0) {
+    reason = "set clause";
+  } else if (OB_ISNULL(ctx.get_sql_ctx()) || OB_ISNULL(ctx.get_sql_ctx()->schema_guard_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql ctx is null", K(ret), KP(ctx.get_sql_ctx()));
+  } else if (OB_FAIL(ctx.get_sql_ctx()->schema_guard_->get_table_schema(
+             load_args.tenant_id_, load_args.table_id_, table_schema))) {
+    LOG_WARN("fail to get table schema", K(ret), K(load_args.table_id_));
+  } else if (OB_ISNULL(table_schema)) {
+    ret = OB_TABLE_NOT_EXIST;
+    LOG_WARN("table not exist", K(ret), K(load_args.table_id_));
+  } else if (table_schema->is_heap_table()) {
+    reason = "table without primary key";
+  } else if (table_schema->get_index_tid_count() > 0) {
+    reason = "table with index";
+  } else if (table_schema->get_foreign_key_infos().count() > 0
+             || table_schema->get_trigger_list().count() > 0) {
+    reason = "table with foreign key or trigger";
+  } else {
+    ObSEArray<ColumnInfo, 16> column_infos;
+    int64_t rowkey_column_num = 0;
+    if (OB_FAIL(init_column_infos(*table_schema, load_stmt, column_infos, rowkey_column_num))) {
+      if (OB_NOT_SUPPORTED == ret) {
+        reason = "file fields not match table columns, or unsupported column";
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("fail to init column infos", K(ret));
+      }
+    }
+  }
+
+  if (OB_SUCC(ret) && is_supported && nullptr == reason) {
+    ObLSID ls_id;
+    ObAddr leader;
+    bool is_cache_hit = false;
+    if (OB_ISNULL(GCTX.location_service_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("location service is null", K(ret));
+    } else if (OB_FAIL(GCTX.location_service_->get(load_args.tenant_id_, table_schema->get_tablet_id(),
+                                                   INT64_MAX, is_cache_hit, ls_id))) {
+      LOG_WARN("fail to get ls id", K(ret), "tablet_id", table_schema->get_tablet_id());
+    } else if (OB_FAIL(GCTX.location_service_->get_leader(GCONF.cluster_id, load_args.tenant_id_,
+                                                          ls_id, false, leader))) {
+      LOG_WARN("fail to get ls leader", K(ret), K(ls_id));
+    } else if (leader != GCTX.self_addr()) {
+      // the tablet context writes redo through the local log stream
+      reason = "ls leader not on this server";
+    }
+  }
+
+  if (OB_SUCC(ret) && is_supported && nullptr == reason) {
+    // a cheap pre-check without lock, execute checks again after locking the table
+    bool is_empty = false;
+    if (OB_ISNULL(GCTX.sql_proxy_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("sql proxy is null", K(ret));
+    } else if (OB_FAIL(check_table_empty(*GCTX.sql_proxy_, load_args, is_empty))) {
+      LOG_WARN("fail to check table empty", K(ret));
+    } else if (!is_empty) {
+      reason = "table not empty";
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    is_supported = false;
+  } else if (nullptr != reason) {
+    is_supported = false;
+    LOG_INFO("LOAD DATA direct path not supported, fall back", K(reason),
+             "table_name", load_args.combined_name_);
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::check_table_empty(ObISQLClient &sql_client,
+                                            const ObLoadArgument &load_args,
+                                            bool &is_empty)
+{
+  int ret = OB_SUCCESS;
+  ObSqlString sql;
+  is_empty = false;
+  if (OB_FAIL(sql.assign_fmt("SELECT 1 FROM %.*s LIMIT 1",
+                             load_args.combined_name_.length(),
+                             load_args.combined_name_.ptr()))) {
+    LOG_WARN("fail to assign sql", K(ret));
+  } else {
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      sqlclient::ObMySQLResult *result = nullptr;
+      if (OB_FAIL(sql_client.read(res, load_args.tenant_id_, sql.ptr()))) {
+        LOG_WARN("fail to execute sql", K(ret), K(sql));
+      } else if (OB_ISNULL(result = res.get_result())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("result is null", K(ret), K(sql));
+      } else if (OB_FAIL(result->next())) {
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+          is_empty = true;
+        } else {
+          LOG_WARN("fail to get next row", K(ret), K(sql));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::lock_table(ObMySQLTransaction &trans, const ObLoadArgument &load_args)
+{
+  int ret = OB_SUCCESS;
+  observer::ObInnerSQLConnection *conn = nullptr;
+  bool is_empty = false;
+  if (OB_ISNULL(GCTX.sql_proxy_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql proxy is null", K(ret));
+  } else if (OB_FAIL(trans.start(GCTX.sql_proxy_, tenant_id_))) {
+    LOG_WARN("fail to start trans", K(ret), K_(tenant_id));
+  } else if (OB_ISNULL(conn = dynamic_cast<observer::ObInnerSQLConnection *>(trans.get_connection()))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("conn is null", K(ret));
+  } else if (OB_FAIL(conn->lock_table(tenant_id_, table_id_, transaction::tablelock::EXCLUSIVE,
+                                      THIS_WORKER.get_timeout_remain()))) {
+    LOG_WARN("fail to lock table", K(ret), K_(tenant_id), K_(table_id));
+  } else if (OB_FAIL(check_table_empty(trans, load_args, is_empty))) {
+    LOG_WARN("fail to check table empty", K(ret));
+  } else if (!is_empty) {
+    // the major sstable built by direct path replaces the data of the tablet
+    need_fall_back_ = true;
+    LOG_INFO("LOAD DATA direct path table not empty, fall back", K_(table_id));
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::init_column_infos(const ObTableSchema &table_schema,
+                                            ObLoadDataStmt &load_stmt,
+                                            ObIArray<ColumnInfo> &column_infos,
+                                            int64_t &rowkey_column_num)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObColDesc, 16> col_descs;
+  const ObIArray<ObLoadDataStmt::FieldOrVarStruct> &field_list = load_stmt.get_field_or_var_list();
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  rowkey_column_num = table_schema.get_rowkey_column_num();
+  column_infos.reset();
+  for (int64_t i = 0; OB_SUCC(ret) && i < field_list.count(); ++i) {
+    if (!field_list.at(i).is_table_column_) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("user variable in field list", K(ret), K(i));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(table_schema.get_multi_version_column_descs(col_descs))) {
+    LOG_WARN("fail to get multi version column descs", K(ret));
+  } else if (OB_UNLIKELY(col_descs.count() - extra_rowkey_cnt != field_list.count())) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_TRACE("field count not match column count", K(ret), K(col_descs.count()), K(field_list.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < col_descs.count(); ++i) {
+    const ObColumnSchemaV2 *column_schema = nullptr;
+    ColumnInfo column_info;
+    if (i >= rowkey_column_num && i < rowkey_column_num + extra_rowkey_cnt) {
+      // skip multi version extra rowkey columns
+    } else if (OB_ISNULL(column_schema = table_schema.get_column_schema(col_descs.at(i).col_id_))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("column schema is null", K(ret), K(col_descs.at(i)));
+    } else if (ob_is_enumset_tc(column_schema->get_data_type())) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("enum or set column", K(ret), KPC(column_schema));
+    } else if (column_schema->is_stored_generated_column()) {
+      // the value is computed by the generated expr, not taken from the file
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("stored generated column", K(ret), KPC(column_schema));
+    } else {
+      for (int64_t j = 0; j < field_list.count(); ++j) {
+        if (field_list.at(j).column_id_ == column_schema->get_column_id()) {
+          column_info.field_idx_ = j;
+          break;
+        }
+      }
+      if (OB_UNLIKELY(column_info.field_idx_ < 0)) {
+        ret = OB_NOT_SUPPORTED;
+        LOG_TRACE("column not in field list", K(ret), KPC(column_schema));
+      } else {
+        column_info.meta_ = column_schema->get_meta_type();
+        column_info.accuracy_ = column_schema->get_accuracy();
+        column_info.is_nullable_ = column_schema->is_nullable();
+        column_info.is_string_type_ = ob_is_string_tc(column_schema->get_data_type());
+        column_info.is_autoinc_ = column_schema->is_autoincrement();
+        if (OB_FAIL(column_infos.push_back(column_info))) {
+          LOG_WARN("fail to push back", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::alloc_file_buffer(ObLoadFileBuffer *&buffer)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(buf = ob_malloc(ObLoadFileBuffer::MAX_BUFFER_SIZE,
+                                ObMemAttr(tenant_id_, ObModIds::OB_SQL_LOAD_DATA)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret));
+  } else {
+    buffer = new (buf) ObLoadFileBuffer(ObLoadFileBuffer::MAX_BUFFER_SIZE - sizeof(ObLoadFileBuffer));
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::init_worker(ParseWorker &worker, const ObLoadDataStmt &load_stmt)
+{
+  int ret = OB_SUCCESS;
+  const ObLoadArgument &load_args = load_stmt.get_load_arguments();
+  const int64_t column_count = column_infos_.count();
+  ObObj *cells = nullptr;
+  worker.compare_.set_rowkey_column_num(rowkey_column_num_);
+  if (OB_FAIL(worker.parser_.init(load_stmt.get_data_struct_in_file(),
+                                  load_stmt.get_field_or_var_list().count(),
+                                  load_args.file_cs_type_))) {
+    LOG_WARN("fail to init parser", K(ret));
+  } else if (OB_FAIL(alloc_file_buffer(worker.data_buffer_))) {
+    LOG_WARN("fail to alloc data buffer", K(ret));
+  } else if (OB_FAIL(alloc_file_buffer(worker.escape_buffer_))) {
+    LOG_WARN("fail to alloc escape buffer", K(ret));
+  } else if (OB_ISNULL(cells = static_cast<ObObj *>(worker.allocator_.alloc(sizeof(ObObj) * column_count)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(column_count));
+  } else if (OB_FAIL(worker.sorter_.init(SORT_MEMORY_LIMIT_PER_THREAD,
+                                         ObExternalSortConstant::DEFAULT_FILE_READ_WRITE_BUFFER,
+                                         expire_ts_, tenant_id_, &worker.compare_))) {
+    LOG_WARN("fail to init external sort", K(ret));
+  } else {
+    new (cells) ObObj[column_count];
+    worker.row_.cells_ = cells;
+    worker.row_.count_ = column_count;
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::init(ObExecContext &ctx, ObLoadDataStmt &load_stmt)
+{
+  int ret = OB_SUCCESS;
+  const ObLoadArgument &load_args = load_stmt.get_load_arguments();
+  const ObLoadDataHint &hint = load_stmt.get_hints();
+  ObSQLSessionInfo *session = nullptr;
+  const ObTableSchema *table_schema = nullptr;
+  int64_t hint_parallel = 0;
+  int64_t autoinc_cache_size = 0;
+  bool is_cache_hit = false;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObLoadDataDirectImpl init twice", K(ret));
+  } else if (OB_ISNULL(session = ctx.get_my_session())
+      || OB_ISNULL(ctx.get_sql_ctx()) || OB_ISNULL(ctx.get_sql_ctx()->schema_guard_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("session or sql ctx is null", K(ret), KP(session), KP(ctx.get_sql_ctx()));
+  } else if (OB_FAIL(ctx.get_sql_ctx()->schema_guard_->get_table_schema(
+             load_args.tenant_id_, load_args.table_id_, table_schema))) {
+    LOG_WARN("fail to get table schema", K(ret), K(load_args.table_id_));
+  } else if (OB_ISNULL(table_schema)) {
+    ret = OB_TABLE_NOT_EXIST;
+    LOG_WARN("table not exist", K(ret), K(load_args.table_id_));
+  } else if (OB_FAIL(init_column_infos(*table_schema, load_stmt, column_infos_, rowkey_column_num_))) {
+    LOG_WARN("fail to init column infos", K(ret));
+  } else if (OB_FAIL(GCTX.location_service_->get(load_args.tenant_id_, table_schema->get_tablet_id(),
+                                                 INT64_MAX, is_cache_hit, ls_id_))) {
+    LOG_WARN("fail to get ls id", K(ret), "tablet_id", table_schema->get_tablet_id());
+  } else if (OB_FAIL(ObSQLUtils::get_default_cast_mode(session, cast_mode_))) {
+    LOG_WARN("fail to get default cast mode", K(ret));
+  } else if (OB_FAIL(hint.get_value(ObLoadDataHint::PARALLEL_THREADS, hint_parallel))) {
+    LOG_WARN("fail to get value", K(ret));
+  } else if (OB_FAIL(session->get_auto_increment_cache_size(autoinc_cache_size))) {
+    LOG_WARN("fail to get auto increment cache size", K(ret));
+  } else {
+    tenant_id_ = load_args.tenant_id_;
+    table_id_ = load_args.table_id_;
+    schema_version_ = table_schema->get_schema_version();
+    tablet_id_ = table_schema->get_tablet_id();
+    ignore_rows_ = load_args.ignore_rows_;
+    parallel_ = hint_parallel > 0 ? hint_parallel : DEFAULT_PARALLEL_THREAD_COUNT;
+    parallel_ = std::min(parallel_, MAX_PARALLEL_THREAD_COUNT);
+    expire_ts_ = THIS_WORKER.get_timeout_ts();
+    file_cs_type_ = load_args.file_cs_type_;
+    compat_mode_ = THIS_WORKER.get_compatibility_mode();
+    dtc_params_ = ObBasicSessionInfo::create_dtc_params(session);
+    merge_compare_.set_rowkey_column_num(rowkey_column_num_);
+    formats_.init(load_stmt.get_data_struct_in_file());
+    if (0 != table_schema->get_autoinc_column_id()) {
+      const uint64_t autoinc_col_id = table_schema->get_autoinc_column_id();
+      const ObColumnSchemaV2 *autoinc_column = table_schema->get_column_schema(autoinc_col_id);
+      if (OB_ISNULL(autoinc_column)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("autoinc column schema is null", K(ret), K(autoinc_col_id));
+      } else {
+        autoinc_param_.tenant_id_ = tenant_id_;
+        autoinc_param_.autoinc_table_id_ = table_id_;
+        autoinc_param_.autoinc_first_part_num_ = table_schema->get_first_part_num();
+        autoinc_param_.autoinc_table_part_num_ = table_schema->get_all_part_num();
+        autoinc_param_.autoinc_col_id_ = autoinc_col_id;
+        autoinc_param_.autoinc_col_type_ = autoinc_column->get_data_type();
+        autoinc_param_.part_level_ = table_schema->get_part_level();
+        autoinc_param_.autoinc_desired_count_ = 0;
+        autoinc_param_.autoinc_increment_ = 1;
+        autoinc_param_.autoinc_offset_ = 1;
+        autoinc_param_.auto_increment_cache_size_ = autoinc_cache_size;
+        autoinc_param_.autoinc_mode_is_order_ = table_schema->is_order_auto_increment_mode();
+      }
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(data_trimer_.init(allocator_, formats_))) {
+    LOG_WARN("fail to init data trimer", K(ret));
+  } else if (OB_FAIL(pre_parser_.init(load_stmt.get_data_struct_in_file(),
+                                      load_stmt.get_field_or_var_list().count(),
+                                      load_args.file_cs_type_))) {
+    LOG_WARN("fail to init parser", K(ret));
+  } else if (OB_FAIL(file_reader_.open(load_args.file_name_, false))) {
+    LOG_WARN("fail to open file", K(ret), K(load_args.file_name_));
+  } else if (OB_FAIL(merge_sorter_.init(MERGE_MEMORY_LIMIT,
+                                        ObExternalSortConstant::DEFAULT_FILE_READ_WRITE_BUFFER,
+                                        expire_ts_, tenant_id_, &merge_compare_))) {
+    LOG_WARN("fail to init merge sorter", K(ret));
+  } else {
+    void *buf = nullptr;
+    if (OB_ISNULL(buf = allocator_.alloc(sizeof(ParseWorker) * parallel_))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K_(parallel));
+    } else {
+      workers_ = new (buf) ParseWorker[parallel_];
+      for (int64_t i = 0; OB_SUCC(ret) && i < parallel_; ++i) {
+        if (OB_FAIL(init_worker(workers_[i], load_stmt))) {
+          LOG_WARN("fail to init parse worker", K(ret), K(i));
+        }
+      }
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::next_file_buffer(ObLoadFileBuffer &data_buffer, int64_t limit)
+{
+  int ret = OB_SUCCESS;
+
+  OZ (data_trimer_.recover_incomplate_data(data_buffer));
+  OZ (file_reader_.pread(data_buffer.current_ptr(),
+                         data_buffer.get_remain_len(),
+                         read_cursor_.file_offset_,
+                         read_cursor_.read_size_));
+
+  if (OB_SUCC(ret)) {
+    if (OB_UNLIKELY(0 == read_cursor_.read_size_)) {
+      read_cursor_.is_end_file_ = true;
+    } else {
+      data_buffer.update_pos(read_cursor_.read_size_);
+      int64_t last_proccessed_GBs = read_cursor_.get_total_read_GBs();
+      read_cursor_.commit_read();
+      int64_t processed_GBs = read_cursor_.get_total_read_GBs();
+      if (processed_GBs != last_proccessed_GBs) {
+        LOG_INFO("LOAD DATA direct path file read progress: ", K(processed_GBs));
+      }
+    }
+  }
+
+  if (OB_SUCC(ret) && OB_LIKELY(data_buffer.is_valid())) {
+    int64_t complete_cnt = limit;
+    int64_t complete_len = 0;
+    if (OB_FAIL(pre_parse_lines(data_buffer, pre_parser_,
+                                read_cursor_.is_end_file(),
+                                complete_len, complete_cnt))) {
+      LOG_WARN("fail to fast_lines_parse", K(ret));
+    } else if (OB_FAIL(data_trimer_.backup_incomplate_data(data_buffer, complete_len))) {
+      LOG_WARN("fail to back up data", K(ret));
+    } else {
+      data_trimer_.commit_line_cnt(complete_cnt);
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::skip_ignore_rows()
+{
+  int ret = OB_SUCCESS;
+  ObLoadFileBuffer *buffer = workers_[0].data_buffer_;
+  while (OB_SUCC(ret)
+         && !read_cursor_.is_end_file()
+         && data_trimer_.get_lines_count() < ignore_rows_) {
+    buffer->reset();
+    if (OB_FAIL(next_file_buffer(*buffer, ignore_rows_ - data_trimer_.get_lines_count()))) {
+      LOG_WARN("fail to read file buffer", K(ret));
+    }
+  }
+  buffer->reset();
+  return ret;
+}
+
+int ObLoadDataDirectImpl::add_line(ParseWorker &worker, ObIArray<ObCSVGeneralParser::FieldValue> &fields)
+{
+  int ret = OB_SUCCESS;
+  worker.cast_allocator_.reuse();
+  for (int64_t i = 0; OB_SUCC(ret) && i < column_infos_.count(); ++i) {
+    const ColumnInfo &column_info = column_infos_.at(i);
+    ObObj &dest = worker.row_.cells_[i];
+    ObObj src;
+    field_to_obj(src, fields.at(column_info.field_idx_), file_cs_type_, column_info.is_string_type_);
+    if (src.is_null() && column_info.is_autoinc_) {
+      worker.need_autoinc_value_ = true;
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("null value for auto increment column", K(ret), K(i));
+    } else if (src.is_null()) {
+      if (OB_UNLIKELY(!column_info.is_nullable_)) {
+        ret = OB_BAD_NULL_ERROR;
+        LOG_WARN("null value for not null column", K(ret), K(i), K(column_info));
+      } else {
+        dest.set_null();
+      }
+    } else {
+      ObCastCtx cast_ctx(&worker.cast_allocator_, &dtc_params_, cast_mode_,
+                         column_info.meta_.get_collation_type());
+      ObObj casted;
+      const ObObj *res_obj = nullptr;
+      if (OB_FAIL(ObObjCaster::to_type(column_info.meta_.get_type(),
+                                       column_info.meta_.get_collation_type(),
+                                       cast_ctx, src, casted))) {
+        LOG_WARN("fail to cast obj", K(ret), K(src), K(column_info));
+      } else if (OB_FAIL(obj_accuracy_check(cast_ctx, column_info.accuracy_,
+                                            column_info.meta_.get_collation_type(),
+                                            casted, dest, res_obj))) {
+        LOG_WARN("fail to check accuracy", K(ret), K(casted), K(column_info));
+      } else if (OB_ISNULL(res_obj)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("accuracy check result is null", K(ret));
+      } else if (res_obj != &dest) {
+        dest = *res_obj;
+      }
+      if (OB_SUCC(ret) && column_info.is_autoinc_) {
+        bool is_zero = false;
+        uint64_t autoinc_value = 0;
+        if (OB_FAIL(get_autoinc_value(dest, is_zero, autoinc_value))) {
+          LOG_WARN("fail to get auto increment value", K(ret), K(dest));
+        } else if (is_zero) {
+          worker.need_autoinc_value_ = true;
+          ret = OB_NOT_SUPPORTED;
+          LOG_TRACE("zero value for auto increment column", K(ret), K(i));
+        } else {
+          worker.max_autoinc_value_ = std::max(worker.max_autoinc_value_, autoinc_value);
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(worker.sorter_.add_item(worker.row_))) {
+    LOG_WARN("fail to add row to external sort", K(ret));
+  } else {
+    ++worker.row_count_;
+  }
+  return ret;
+}
+
+// same as ObExprAutoincNextval::get_uint_value
+int ObLoadDataDirectImpl::get_autoinc_value(const ObObj &obj, bool &is_zero, uint64_t &value)
+{
+  int ret = OB_SUCCESS;
+  switch (obj.get_type_class()) {
+    case ObIntTC: {
+      is_zero = 0 == obj.get_int();
+      value = obj.get_int() < 0 ? 0 : obj.get_int();
+      break;
+    }
+    case ObUIntTC: {
+      is_zero = 0 == obj.get_uint64();
+      value = obj.get_uint64();
+      break;
+    }
+    case ObFloatTC: {
+      is_zero = 0 == obj.get_float();
+      value = obj.get_float() > 0 ? static_cast<uint64_t>(obj.get_float() + 0.5) : 0;
+      break;
+    }
+    case ObDoubleTC: {
+      is_zero = 0 == obj.get_double();
+      value = obj.get_double() > 0 ? static_cast<uint64_t>(obj.get_double() + 0.5) : 0;
+      break;
+    }
+    default: {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("only int/float/double types support auto increment", K(ret), K(obj));
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::parse_buffer(ParseWorker &worker)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 1> err_records;
+  const char *ptr = worker.data_buffer_->begin_ptr();
+  const char *end = ptr + worker.data_buffer_->get_data_len();
+  auto handle_one_line = [this, &worker](ObIArray<ObCSVGeneralParser::FieldValue> &fields_per_line) -> int {
+    return add_line(worker, fields_per_line);
+  };
+  while (OB_SUCC(ret) && ptr < end) {
+    int64_t nrows = INT64_MAX;
+    err_records.reuse();
+    if (OB_FAIL(worker.parser_.scan<decltype(handle_one_line), true>(
+                ptr, end, nrows,
+                worker.escape_buffer_->begin_ptr(),
+                worker.escape_buffer_->begin_ptr() + worker.escape_buffer_->get_buffer_size(),
+                handle_one_line, err_records, true))) {
+      LOG_WARN("fail to scan buffer", K(ret));
+    } else if (OB_UNLIKELY(0 == nrows)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("no line parsed from buffer", K(ret), K(end - ptr));
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::parse_and_sort(const int64_t worker_idx)
+{
+  int ret = OB_SUCCESS;
+  ParseWorker &worker = workers_[worker_idx];
+  lib::CompatModeGuard compat_guard(compat_mode_);
+  bool is_end_file = false;
+  while (OB_SUCC(ret) && !is_end_file) {
+    worker.data_buffer_->reset();
+    {
+      lib::ObMutexGuard guard(read_mutex_);
+      if (read_cursor_.is_end_file()) {
+        is_end_file = true;
+      } else if (OB_FAIL(next_file_buffer(*worker.data_buffer_))) {
+        LOG_WARN("fail to read file buffer", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && worker.data_buffer_->is_valid()) {
+      if (OB_FAIL(parse_buffer(worker))) {
+        LOG_WARN("fail to parse buffer", K(ret), K(worker_idx));
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < parallel_; ++i) {
+      if (OB_SUCCESS != ATOMIC_LOAD(&worker_rets_[i])) {
+        ret = OB_CANCELED;
+      }
+    }
+    if (OB_SUCC(ret) && ObExternalSortConstant::is_timeout(expire_ts_)) {
+      ret = OB_TIMEOUT;
+      LOG_WARN("LOAD DATA direct path timeout", K(ret), K_(expire_ts));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(worker.sorter_.do_sort(false))) {
+      LOG_WARN("fail to do sort", K(ret), K(worker_idx));
+    }
+  }
+  LOG_INFO("LOAD DATA direct path parse worker finish", K(ret), K(worker_idx), K(worker.row_count_));
+  return ret;
+}
+
+int ObLoadDataDirectImpl::parallel_parse_and_sort()
+{
+  int ret = OB_SUCCESS;
+  ParseThreadPool thread_pool(*this);
+  thread_pool.set_run_wrapper(MTL_CTX());
+  if (OB_FAIL(thread_pool.set_thread_count(parallel_))) {
+    LOG_WARN("fail to set thread count", K(ret), K_(parallel));
+  } else if (OB_FAIL(thread_pool.start())) {
+    LOG_WARN("fail to start parse threads", K(ret), K_(parallel));
+  } else {
+    thread_pool.wait();
+    thread_pool.destroy();
+    for (int64_t i = 0; OB_SUCC(ret) && i < parallel_; ++i) {
+      ret = worker_rets_[i];
+    }
+    // report the first real error instead of OB_CANCELED
+    for (int64_t i = 0; OB_CANCELED == ret && i < parallel_; ++i) {
+      if (OB_SUCCESS != worker_rets_[i] && OB_CANCELED != worker_rets_[i]) {
+        ret = worker_rets_[i];
+      }
+    }
+    // generating auto-increment values is left to the insert path
+    for (int64_t i = 0; OB_FAIL(ret) && i < parallel_; ++i) {
+      if (workers_[i].need_autoinc_value_) {
+        need_fall_back_ = true;
+        ret = OB_SUCCESS;
+        LOG_INFO("LOAD DATA direct path auto increment value needed, fall back", K_(table_id));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::merge_sorted_runs()
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < parallel_; ++i) {
+    if (OB_FAIL(workers_[i].sorter_.transfer_final_sorted_fragment_iter(merge_sorter_))) {
+      LOG_WARN("fail to transfer sorted fragment", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(merge_sorter_.do_sort(true))) {
+      LOG_WARN("fail to do merge sort", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObLoadDataDirectImpl::write_sstable(ObExecContext &ctx, int64_t &affected_rows)
+{
+  int ret = OB_SUCCESS;
+  ObSSTableInsertManager &sstable_insert_mgr = ObSSTableInsertManager::get_instance();
+  ObSSTableInsertTableParam table_param;
+  int64_t context_id = 0;
+  bool is_context_created = false;
+  int64_t snapshot_version = 0;
+  bool is_external_consistent = false;
+  uint64_t ddl_task_id = OB_INVALID_ID;
+  affected_rows = 0;
+  table_param.exec_ctx_ = &ctx;
+  table_param.dest_table_id_ = table_id_;
+  table_param.write_major_ = true;
+  table_param.schema_version_ = schema_version_;
+  table_param.snapshot_version_ = 0;
+  table_param.task_cnt_ = 1;
+  if (OB_ISNULL(GCTX.sql_proxy_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql proxy is null", K(ret));
+  } else {
+    // LOAD DATA is not scheduled by a rootservice ddl task, but takes its task id from the
+    // same sequence, so that it never collides with the ddl tasks in the ddl kv manager.
+    ObMaxIdFetcher id_fetcher(*GCTX.sql_proxy_);
+    if (OB_FAIL(id_fetcher.fetch_new_max_id(OB_SYS_TENANT_ID, OB_MAX_USED_DDL_TASK_ID_TYPE,
+                                            ddl_task_id, 1L/*ddl start id*/))) {
+      LOG_WARN("fail to fetch new ddl task id", K(ret));
+    } else {
+      table_param.ddl_task_id_ = ddl_task_id;
+      table_param.execution_id_ = ObTimeUtility::fast_current_time();
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(table_param.ls_tablet_ids_.push_back(std::make_pair(ls_id_, tablet_id_)))) {
+    LOG_WARN("fail to push back", K(ret));
+  } else if (OB_FAIL(OB_TS_MGR.get_ts_sync(tenant_id_, THIS_WORKER.get_timeout_remain(),
+                                           snapshot_version, is_external_consistent))) {
+    LOG_WARN("fail to get gts", K(ret), K_(tenant_id));
+  } else if (OB_FAIL(sstable_insert_mgr.create_table_context(table_param, context_id))) {
+    LOG_WARN("fail to create table context", K(ret), K(table_param));
+  } else if (FALSE_IT(is_context_created = true)) {
+  } else if (OB_FAIL(sstable_insert_mgr.update_table_context(context_id, snapshot_version))) {
+    LOG_WARN("fail to update table context", K(ret), K(context_id), K(snapshot_version));
+  } else {
+    ObSSTableInsertTabletParam tablet_param;
+    ObMacroDataSeq block_start_seq;
+    RowIterator row_iter;
+    tablet_param.context_id_ = context_id;
+    tablet_param.ls_id_ = ls_id_;
+    tablet_param.tablet_id_ = tablet_id_;
+    tablet_param.table_id_ = table_id_;
+    tablet_param.write_major_ = true;
+    tablet_param.task_cnt_ = 1;
+    tablet_param.schema_version_ = schema_version_;
+    tablet_param.snapshot_version_ = snapshot_version;
+    tablet_param.execution_id_ = table_param.execution_id_;
+    tablet_param.ddl_task_id_ = table_param.ddl_task_id_;
+    if (OB_FAIL(block_start_seq.set_parallel_degree(0))) {
+      LOG_WARN("fail to set parallel degree", K(ret));
+    } else if (OB_FAIL(row_iter.init(allocator_, merge_sorter_, tablet_id_, column_infos_.count()))) {
+      LOG_WARN("fail to init row iterator", K(ret));
+    } else if (OB_FAIL(sstable_insert_mgr.add_sstable_slice(
+               tablet_param, block_start_seq, row_iter, affected_rows))) {
+      LOG_WARN("fail to add sstable slice", K(ret), K(tablet_param));
+    } else if (OB_FAIL(sstable_insert_mgr.notify_tablet_end(context_id, tablet_id_))) {
+      LOG_WARN("fail to notify tablet end", K(ret), K(context_id), K_(tablet_id));
+    } else if (OB_FAIL(sstable_insert_mgr.finish_ready_tablets(context_id, 1))) {
+      LOG_WARN("fail to finish ready tablets", K(ret), K(context_id));
+    } else {
+      affected_rows = row_iter.get_row_count();
+    }
+  }
+  if (is_context_created) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = sstable_insert_mgr.finish_table_context(context_id, OB_SUCC(ret)))) {
+      LOG_WARN("fail to finish table context", K(tmp_ret), K(context_id));
+      ret = OB_SUCC(ret) ? tmp_ret : ret;
+    }
+  }
+  LOG_INFO("LOAD DATA direct path write sstable", K(ret), K(context_id), K(snapshot_version),
+           K_(ls_id), K_(tablet_id), K(affected_rows));
+  return ret;
+}
+
+int ObLoadDataDirectImpl::sync_autoinc_value()
+{
+  int ret = OB_SUCCESS;
+  uint64_t max_autoinc_value = 0;
+  for (int64_t i = 0; i < parallel_; ++i) {
+    max_autoinc_value = std::max(max_autoinc_value, workers_[i].max_autoinc_value_);
+  }
+  if (0 != autoinc_param_.autoinc_col_id_ && max_autoinc_value > 0) {
+    autoinc_param_.global_value_to_sync_ = max_autoinc_value;
+    if (OB_FAIL(ObAutoincrementService::get_instance().sync_insert_value_global(autoinc_param_))) {
+      LOG_WARN("fail to sync insert value global", K(ret), K_(autoinc_param));
+    }
+  }
+  return ret;
+}
+
+void ObLoadDataDirectImpl::release_resources()
+{
+  merge_sorter_.clean_up();
+  if (nullptr != workers_) {
+    for (int64_t i = 0; i < parallel_; ++i) {
+      ParseWorker &worker = workers_[i];
+      worker.sorter_.clean_up();
+      if (nullptr != worker.data_buffer_) {
+        ob_free(worker.data_buffer_);
+        worker.data_buffer_ = nullptr;
+      }
+      if (nullptr != worker.escape_buffer_) {
+        ob_free(worker.escape_buffer_);
+        worker.escape_buffer_ = nullptr;
+      }
+      worker.~ParseWorker();
+    }
+    workers_ = nullptr;
+  }
+  if (file_reader_.is_opened()) {
+    file_reader_.close();
+  }
+  is_inited_ = false;
+}
+
+int ObLoadDataDirectImpl::execute(ObExecContext &ctx, ObLoadDataStmt &load_stmt)
+{
+  int ret = OB_SUCCESS;
+  int64_t affected_rows = 0;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  int64_t parse_end_ts = 0;
+  // holds the exclusive table lock until the sstable is written
+  ObMySQLTransaction trans;
+
+  OZ (init(ctx, load_stmt));
+
+  LOG_INFO("LOAD DATA direct path start report"
+           , "file_path", load_stmt.get_load_arguments().file_name_
+           , "table_name", load_stmt.get_load_arguments().combined_name_
+           , "parallel", parallel_
+           , K_(ls_id)
+           , K_(tablet_id)
+           );
+
+  OZ (lock_table(trans, load_stmt.get_load_arguments()));
+  if (OB_SUCC(ret) && !need_fall_back_) {
+    OZ (skip_ignore_rows());
+    OZ (parallel_parse_and_sort());
+  }
+  if (OB_SUCC(ret) && !need_fall_back_) {
+    OX (parse_end_ts = ObTimeUtility::current_time());
+    OZ (ObLoadDataUtils::check_session_status(*ctx.get_my_session()));
+    OZ (merge_sorted_runs());
+    OZ (write_sstable(ctx, affected_rows));
+    OZ (sync_autoinc_value());
+
+    if (OB_SUCC(ret) && OB_NOT_NULL(ctx.get_physical_plan_ctx())) {
+      ctx.get_physical_plan_ctx()->set_affected_rows(affected_rows);
+      // the lines skipped by IGNORE n LINES are counted by the trimer too
+      ctx.get_physical_plan_ctx()->set_row_matched_count(
+          data_trimer_.get_lines_count() - std::min(ignore_rows_, data_trimer_.get_lines_count()));
+    }
+  }
+
+  if (trans.is_started()) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = trans.end(OB_SUCC(ret)))) {
+      LOG_WARN("fail to end trans", K(tmp_ret));
+      ret = OB_SUCC(ret) ? tmp_ret : ret;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    LOG_WARN("LOAD DATA direct path execute failed, ", K(ret));
+  }
+
+  LOG_INFO("LOAD DATA direct path finish report"
+           , K(ret)
+           , K_(need_fall_back)
+           , "total lines", data_trimer_.get_lines_count()
+           , K(affected_rows)
+           , "parse and sort time", parse_end_ts - start_ts
+           , "total time", ObTimeUtility::current_time() - start_ts
+           );
+
+  release_resources();
+  return ret;
+}
+
+} // sql
+} // oceanbase
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_LOAD_DATA_DIRECT_IMPL_H_
+#define OCEANBASE_SQL_LOAD_DATA_DIRECT_IMPL_H_
+
+#include "lib/lock/ob_mutex.h"
+#include "lib/mysqlclient/ob_mysql_transaction.h"
+#include "share/ob_autoincrement_param.h"
+#include "share/ob_thread_pool.h"
+#include "storage/ob_i_store.h"
+#include "storage/ob_parallel_external_sort.h"
+#include "storage/ddl/ob_direct_insert_sstable_ctx.h"
+#include "sql/engine/cmd/ob_load_data_impl.h"
+
+namespace oceanbase
+{
+namespace share
+{
+namespace schema
+{
+class ObTableSchema;
+}
+}
+namespace sql
+{
+
+/**
+ * @brief load data direct path implementation
+ *        file buffers are parsed and casted in parallel, each parser sorts its rows by rowkey
+ *        with external sort, the sorted runs are merged and written into a major sstable
+ *        through ObSSTableInsertManager with ddl redo log, bypassing sql, das and memtable.
+ *        only empty non-partitioned tables with primary key and without index are supported,
+ *        see check_supported. the table is locked exclusively in an inner transaction for the
+ *        whole load, if it turns out to be not empty after locking, or some rows need a
+ *        generated auto-increment value, the load falls back to ObLoadDataSPImpl.
+ */
+class ObLoadDataDirectImpl : public ObLoadDataBase
+{
+public:
+  static const int64_t DEFAULT_PARALLEL_THREAD_COUNT = 4;
+  static const int64_t MAX_PARALLEL_THREAD_COUNT = 64;
+  static const int64_t SORT_MEMORY_LIMIT_PER_THREAD = 64LL * 1024LL * 1024LL; // 64M
+  static const int64_t MERGE_MEMORY_LIMIT = 256LL * 1024LL * 1024LL; // 256M
+public:
+  ObLoadDataDirectImpl();
+  virtual ~ObLoadDataDirectImpl();
+  // check whether the load can go through direct path, fall back to ObLoadDataSPImpl if not
+  static int check_supported(ObExecContext &ctx, ObLoadDataStmt &load_stmt, bool &is_supported);
+  virtual int execute(ObExecContext &ctx, ObLoadDataStmt &load_stmt) override;
+  // nothing is written, the caller should load the file with ObLoadDataSPImpl instead
+  bool need_fall_back() const { return need_fall_back_; }
+private:
+  class RowCompare
+  {
+  public:
+    RowCompare(int &sort_ret) : result_code_(sort_ret), rowkey_column_num_(0) {}
+    void set_rowkey_column_num(const int64_t rowkey_column_num) { rowkey_column_num_ = rowkey_column_num; }
+    bool operator()(const common::ObNewRow *left, const common::ObNewRow *right);
+    int &result_code_;
+  private:
+    int64_t rowkey_column_num_;
+  };
+  typedef storage::ObExternalSort<common::ObNewRow, RowCompare> ExternalSort;
+
+  // adds the multi version extra rowkey columns to the merged rows,
+  // the rows with the same rowkey are adjacent after merging and reported as duplicated
+  class RowIterator : public storage::ObISSTableInsertRowIterator
+  {
+  public:
+    RowIterator();
+    virtual ~RowIterator() {}
+    int init(common::ObIAllocator &allocator,
+             ExternalSort &sorter,
+             const common::ObTabletID &tablet_id,
+             const int64_t column_count);
+    virtual void reset() override;
+    virtual int get_next_row(common::ObNewRow *&row) override;
+    virtual int get_next_row_with_tablet_id(
+        const uint64_t table_id,
+        const int64_t rowkey_count,
+        const int64_t snapshot_version,
+        common::ObNewRow *&row,
+        common::ObTabletID &tablet_id) override;
+    int64_t get_row_count() const { return row_count_; }
+  private:
+    int check_rowkey_duplicated(const common::ObNewRow &row, const int64_t rowkey_count);
+  private:
+    ExternalSort *sorter_;
+    common::ObTabletID tablet_id_;
+    common::ObNewRow current_row_;
+    common::ObArenaAllocator rowkey_allocator_;
+    common::ObRowkey last_rowkey_;
+    int64_t row_count_;
+  };
+
+  struct ColumnInfo
+  {
+    ColumnInfo()
+      : field_idx_(-1), meta_(), accuracy_(), is_nullable_(true), is_string_type_(false),
+        is_autoinc_(false)
+    {}
+    TO_STRING_KV(K_(field_idx), K_(meta), K_(accuracy), K_(is_nullable), K_(is_string_type),
+                 K_(is_autoinc));
+    int64_t field_idx_;
+    common::ObObjMeta meta_;
+    common::ObAccuracy accuracy_;
+    bool is_nullable_;
+    bool is_string_type_;
+    bool is_autoinc_;
+  };
+
+  struct ParseWorker
+  {
+    ParseWorker()
+      : sort_ret_(common::OB_SUCCESS), compare_(sort_ret_), data_buffer_(nullptr),
+        escape_buffer_(nullptr), allocator_("TLD_ParseWk"), cast_allocator_("TLD_ParseCast"),
+        row_count_(0), max_autoinc_value_(0), need_autoinc_value_(false)
+    {}
+    int sort_ret_;
+    RowCompare compare_;
+    ExternalSort sorter_;
+    ObCSVGeneralParser parser_;
+    ObLoadFileBuffer *data_buffer_;
+    ObLoadFileBuffer *escape_buffer_;
+    common::ObArenaAllocator allocator_;
+    common::ObArenaAllocator cast_allocator_;
+    common::ObNewRow row_;
+    int64_t row_count_;
+    uint64_t max_autoinc_value_;
+    bool need_autoinc_value_; // a row leaves the auto-increment column to be generated
+  };
+
+  class ParseThreadPool : public share::ObThreadPool
+  {
+  public:
+    explicit ParseThreadPool(ObLoadDataDirectImpl &impl) : impl_(impl) {}
+    virtual ~ParseThreadPool() {}
+    virtual void run1() override;
+  private:
+    ObLoadDataDirectImpl &impl_;
+  };
+
+private:
+  int init(ObExecContext &ctx, ObLoadDataStmt &load_stmt);
+  static int check_table_empty(common::ObISQLClient &sql_client,
+                               const ObLoadArgument &load_args,
+                               bool &is_empty);
+  int lock_table(common::ObMySQLTransaction &trans, const ObLoadArgument &load_args);
+  static int init_column_infos(const share::schema::ObTableSchema &table_schema,
+                               ObLoadDataStmt &load_stmt,
+                               common::ObIArray<ColumnInfo> &column_infos,
+                               int64_t &rowkey_column_num);
+  int init_worker(ParseWorker &worker, const ObLoadDataStmt &load_stmt);
+  int alloc_file_buffer(ObLoadFileBuffer *&buffer);
+  int next_file_buffer(ObLoadFileBuffer &data_buffer, int64_t limit = INT64_MAX);
+  int skip_ignore_rows();
+  int parse_and_sort(const int64_t worker_idx);
+  int parse_buffer(ParseWorker &worker);
+  int add_line(ParseWorker &worker, common::ObIArray<ObCSVGeneralParser::FieldValue> &fields);
+  static int get_autoinc_value(const common::ObObj &obj, bool &is_zero, uint64_t &value);
+  int parallel_parse_and_sort();
+  int merge_sorted_runs();
+  int write_sstable(ObExecContext &ctx, int64_t &affected_rows);
+  int sync_autoinc_value();
+  void release_resources();
+private:
+  bool is_inited_;
+  common::ObArenaAllocator allocator_;
+  // file reading, shared by the parse workers
+  lib::ObMutex read_mutex_;
+  ObFileReader file_reader_;
+  ObFileReadCursor read_cursor_;
+  ObLoadFileDataTrimer data_trimer_;
+  ObCSVFormats formats_;
+  ObCSVGeneralParser pre_parser_;
+  // exec params
+  uint64_t tenant_id_;
+  uint64_t table_id_;
+  int64_t schema_version_;
+  share::ObLSID ls_id_;
+  common::ObTabletID tablet_id_;
+  int64_t rowkey_column_num_;
+  int64_t ignore_rows_;
+  int64_t parallel_;
+  int64_t expire_ts_;
+  common::ObCollationType file_cs_type_;
+  lib::Worker::CompatMode compat_mode_;
+  common::ObDataTypeCastParams dtc_params_;
+  common::ObCastMode cast_mode_;
+  common::ObSEArray<ColumnInfo, 16> column_infos_; // rowkey columns first, in storage order
+  share::AutoincParam autoinc_param_; // autoinc_col_id_ is 0 without auto-increment column
+  bool need_fall_back_;
+  // parse and sort
+  ParseWorker *workers_;
+  int worker_rets_[MAX_PARALLEL_THREAD_COUNT];
+  int merge_sort_ret_;
+  RowCompare merge_compare_;
+  ExternalSort merge_sorter_;
+  DISALLOW_COPY_AND_ASSIGN(ObLoadDataDirectImpl);
+};
+
+} // sql
+} // oceanbase
+
+#endif /* OCEANBASE_SQL_LOAD_DATA_DIRECT_IMPL_H_ */
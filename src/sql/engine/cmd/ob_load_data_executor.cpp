@@ -16,6 +16,7 @@
 
 #include "lib/oblog/ob_log_module.h"
 #include "sql/engine/cmd/ob_load_data_impl.h"
+#include "sql/engine/cmd/ob_load_data_direct_impl.h"
 #include "sql/engine/ob_exec_context.h"
 
 namespace oceanbase
@@ -26,9 +27,28 @@ int ObLoadDataExecutor::execute(ObExecContext &ctx, ObLoadDataStmt &stmt)
 {
   int ret = OB_SUCCESS;
   ObLoadDataBase *load_impl = NULL;
+  bool use_direct_path = false;
   if (!stmt.get_load_arguments().is_csv_format_) {
     ret = OB_NOT_SUPPORTED;
     LOG_WARN("invalid resolver results", K(ret));
+  } else if (OB_FAIL(ObLoadDataDirectImpl::check_supported(ctx, stmt, use_direct_path))) {
+    LOG_WARN("fail to check direct path load data", K(ret));
+  } else if (use_direct_path) {
+    ObLoadDataDirectImpl *direct_impl = NULL;
+    if (OB_ISNULL(direct_impl = OB_NEWx(ObLoadDataDirectImpl, (&ctx.get_allocator())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret));
+    } else {
+      if (OB_FAIL(direct_impl->execute(ctx, stmt))) {
+        LOG_WARN("failed to execute load data stmt by direct path", K(ret));
+      } else {
+        // the table got rows after check_supported, or the file needs auto-increment values
+        use_direct_path = !direct_impl->need_fall_back();
+      }
+      direct_impl->~ObLoadDataDirectImpl();
+    }
+  }
+  if (OB_FAIL(ret) || use_direct_path) {
   } else if (OB_ISNULL(load_impl = OB_NEWx(ObLoadDataSPImpl, (&ctx.get_allocator())))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("allocate memory failed", K(ret));
@@ -440,9 +440,14 @@ int ObLoadDataBase::pre_parse_lines(ObLoadFileBuffer &buffer,
     LOG_WARN("invalid buffer", K(ret));
   } else if (parser.get_opt_params().is_simple_format_) {
     const ObCSVGeneralFormat &format = parser.get_format();
+    const ObCSVSpecialCharFinder &finder = parser.get_line_term_finder();
     char *cur_pos = buffer.begin_ptr();
     int64_t cur_lines = 0;
     for (char *p = buffer.begin_ptr(); p < buffer.current_ptr(); ++p) {
+      p = const_cast<char *>(finder.find(p, buffer.current_ptr()));
+      if (p >= buffer.current_ptr()) {
+        break;
+      }
       char cur_char = *p;
       if (format.field_escaped_char_ == cur_char && p + 1 < buffer.current_ptr()) {
         p++;
@@ -63,6 +63,18 @@ int ObCSVGeneralParser::init(const ObDataInFileStruct &format,
         && !opt_param_.is_same_escape_enclosed_
         && format_.field_enclosed_char_ == INT64_MAX;
 
+    // multi-byte chars are always stepped over by mbcharlen as a whole,
+    // the trail bytes of gbk and gb18030 may be ascii
+    const bool stop_at_non_ascii = (CHARSET_BINARY != format_.cs_type_);
+    special_char_finder_.reset();
+    special_char_finder_.set_stop_at_non_ascii(stop_at_non_ascii);
+    special_char_finder_.add_char(opt_param_.field_term_c_);
+    special_char_finder_.add_char(opt_param_.line_term_c_);
+    special_char_finder_.add_char(format_.field_escaped_char_);
+    special_char_finder_.add_char(format_.field_enclosed_char_);
+    line_term_finder_.reset();
+    line_term_finder_.add_char(opt_param_.line_term_c_);
+    line_term_finder_.add_char(format_.field_escaped_char_);
   }
 
   if (OB_SUCC(ret) && OB_FAIL(fields_per_line_.prepare_allocate(file_column_nums))) {
@@ -10,6 +10,7 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#include <climits>
 #include "lib/charset/ob_charset.h"
 #include "common/object/ob_object.h"
 #include "lib/container/ob_se_array.h"
@@ -18,6 +19,12 @@
 #ifndef _OB_LOAD_DATA_PARSER_H_
 #define _OB_LOAD_DATA_PARSER_H_
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace oceanbase
 {
 namespace sql
@@ -40,6 +47,100 @@ struct ObCSVGeneralFormat {
   int64_t file_column_nums_;
 };
 
+/**
+ * @brief find the first special char (terminators, escape, enclose) in a buffer,
+ *        compares 32 (AVX2) or 16 (SSE2) bytes at a time with cmpeq + movemask.
+ *        For multi-byte charsets it also stops at non-ascii bytes, so that the caller
+ *        can step over the whole character with mbcharlen, the trail byte of a gbk
+ *        character may equal to a special ascii char.
+ */
+class ObCSVSpecialCharFinder
+{
+public:
+  static const int64_t MAX_SPECIAL_CHAR_CNT = 4;
+  ObCSVSpecialCharFinder() : char_cnt_(0), stop_at_non_ascii_(false)
+  {
+    MEMSET(chars_, 0, sizeof(chars_));
+  }
+  void reset() { char_cnt_ = 0; stop_at_non_ascii_ = false; }
+  // chars out of the char range (e.g. INT64_MAX for an absent escape char) never match, ignored
+  void add_char(const int64_t c)
+  {
+    if (c >= CHAR_MIN && c <= CHAR_MAX && char_cnt_ < MAX_SPECIAL_CHAR_CNT) {
+      chars_[char_cnt_++] = static_cast<char>(c);
+    }
+  }
+  void set_stop_at_non_ascii(const bool stop_at_non_ascii) { stop_at_non_ascii_ = stop_at_non_ascii; }
+
+  inline bool is_special_char(const char c) const
+  {
+    bool bret = stop_at_non_ascii_ && (static_cast<unsigned char>(c) >= 0x80);
+    for (int64_t i = 0; !bret && i < char_cnt_; ++i) {
+      bret = (chars_[i] == c);
+    }
+    return bret;
+  }
+
+  // return the position of the first special char, or end if not found
+  inline const char *find(const char *str, const char *end) const
+  {
+    if (char_cnt_ > 0) {
+#if defined(__AVX2__)
+      const int64_t STEP = 32;
+      __m256i patterns[MAX_SPECIAL_CHAR_CNT];
+      for (int64_t i = 0; i < char_cnt_; ++i) {
+        patterns[i] = _mm256_set1_epi8(chars_[i]);
+      }
+      while (end - str >= STEP) {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str));
+        __m256i hit = _mm256_cmpeq_epi8(data, patterns[0]);
+        for (int64_t i = 1; i < char_cnt_; ++i) {
+          hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(data, patterns[i]));
+        }
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hit));
+        if (stop_at_non_ascii_) {
+          mask |= static_cast<uint32_t>(_mm256_movemask_epi8(data));
+        }
+        if (0 != mask) {
+          return str + __builtin_ctz(mask);
+        }
+        str += STEP;
+      }
+#elif defined(__SSE2__)
+      const int64_t STEP = 16;
+      __m128i patterns[MAX_SPECIAL_CHAR_CNT];
+      for (int64_t i = 0; i < char_cnt_; ++i) {
+        patterns[i] = _mm_set1_epi8(chars_[i]);
+      }
+      while (end - str >= STEP) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str));
+        __m128i hit = _mm_cmpeq_epi8(data, patterns[0]);
+        for (int64_t i = 1; i < char_cnt_; ++i) {
+          hit = _mm_or_si128(hit, _mm_cmpeq_epi8(data, patterns[i]));
+        }
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hit));
+        if (stop_at_non_ascii_) {
+          mask |= static_cast<uint32_t>(_mm_movemask_epi8(data));
+        }
+        if (0 != mask) {
+          return str + __builtin_ctz(mask);
+        }
+        str += STEP;
+      }
+#endif
+    }
+    while (str < end && !is_special_char(*str)) {
+      ++str;
+    }
+    return str;
+  }
+  TO_STRING_KV(K_(char_cnt), K_(stop_at_non_ascii));
+private:
+  char chars_[MAX_SPECIAL_CHAR_CNT];
+  int64_t char_cnt_;
+  bool stop_at_non_ascii_;
+};
+
 /**
  * @brief Fast csv general parser is mysql compatible csv parser
  *        It support single-byte or multi-byte seperators
@@ -125,6 +226,8 @@ public:
     return ret;
   }
   common::ObIArray<FieldValue>& get_fields_per_line() { return fields_per_line_; }
+  // finds escape char and line term char, used by simple format line splitting
+  const ObCSVSpecialCharFinder &get_line_term_finder() const { return line_term_finder_; }
 
 private:
   template<common::ObCharsetType cs_type>
@@ -183,6 +286,8 @@ protected:
   ObCSVGeneralFormat format_;
   common::ObSEArray<FieldValue, 1> fields_per_line_;
   OptParams opt_param_;
+  ObCSVSpecialCharFinder special_char_finder_;
+  ObCSVSpecialCharFinder line_term_finder_;
 };
 
 
@@ -331,6 +436,8 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
           if (!is_term) {
             int mb_len = mbcharlen<cs_type>(str, end);
             str += mb_len;
+            // skip the plain chars in between
+            str = special_char_finder_.find(str, end);
           }
         }
       }
@@ -32,6 +32,8 @@ void ObExprJoinFilter::ObExprJoinFilterContext::reset_monitor_info()
   check_count_ = 0;
   n_times_ = 0;
   ready_ts_ = 0;
+  range_filter_count_ = 0;
+  in_filter_count_ = 0;
   is_ready_ = false;
 }
 
@@ -61,6 +63,13 @@ int ObExprJoinFilter::calc_result_typeN(ObExprResType& type,
   return ret;
 }
 
+bool ObExprJoinFilter::need_check_range(const ObExpr &expr, const ObPxBloomFilter &filter)
+{
+  return filter.has_range()
+         && 1 == expr.arg_cnt_
+         && ObIntTC == ob_obj_type_class(expr.args_[0]->datum_meta_.type_);
+}
+
 int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx,
                                         ObDatum &res)
 {
@@ -124,8 +133,9 @@ int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx,
           }
         }
         if (OB_SUCC(ret)) {
-          if (OB_FAIL(bloom_filter_ptr_->might_contain(hash_val, is_match))) {
-            LOG_WARN("fail to check filter might contain value", K(ret), K(hash_val));
+          const ObDatum *range_key = need_check_range(expr, *bloom_filter_ptr_) ? datum : NULL;
+          if (OB_FAIL(check_contain(*join_filter_ctx, range_key, hash_val, is_match))) {
+            LOG_WARN("fail to check join filter contain value", K(ret), K(hash_val));
           } else {
             join_filter_ctx->check_count_++;
           }
@@ -229,13 +239,21 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
             }
           }
         }
-        if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
+        const bool check_range = need_check_range(expr, *bloom_filter_ptr_);
+        const ObDatum *range_keys = check_range ? expr.args_[0]->locate_batch_datums(ctx) : NULL;
+        const bool is_batch_key = check_range && expr.args_[0]->is_batch_result();
+        if (OB_FAIL(ret)) {
+        } else if (!bloom_filter_ptr_->is_in_list_valid()
+                   && OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
               [&](int64_t idx) __attribute__((always_inline)) {
                 bloom_filter_ptr_->prefetch_bits_block(hash_values[idx]); return OB_SUCCESS;
               }))) {
         } else if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
             [&](int64_t idx) __attribute__((always_inline)) {
-              ret = bloom_filter_ptr_->might_contain(hash_values[idx], is_match);
+              ret = check_contain(*join_filter_ctx,
+                                  check_range ? &range_keys[is_batch_key ? idx : 0] : NULL,
+                                  hash_values[idx],
+                                  is_match);
               ++join_filter_ctx->check_count_;
               ++join_filter_ctx->total_count_;
               join_filter_ctx->filter_count_ += !is_match;
@@ -262,6 +280,44 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
   return ret;
 }
 
+int ObExprJoinFilter::check_bypass(const ObExpr &expr, ObEvalCtx &ctx, bool &is_bypass)
+{
+  int ret = OB_SUCCESS;
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  is_bypass = false;
+  if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+            ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+    // join filter ctx may be null in das, all rows pass.
+    is_bypass = true;
+  } else if (join_filter_ctx->is_ready_ || join_filter_ctx->wait_ready_) {
+    // filter rows, or wait for the bloom filter in eval function
+  } else {
+    ObPxBloomFilter *&bloom_filter_ptr_ = join_filter_ctx->bloom_filter_ptr_;
+    // called once per micro block, cheap enough to probe every time
+    if (OB_ISNULL(bloom_filter_ptr_)
+        && OB_FAIL(ObPxBloomFilterManager::instance().get_px_bloom_filter(join_filter_ctx->bf_key_,
+                                                                         bloom_filter_ptr_))) {
+      ret = OB_SUCCESS;
+    }
+    if (OB_NOT_NULL(bloom_filter_ptr_) && bloom_filter_ptr_->check_ready()) {
+      join_filter_ctx->ready_ts_ = ObTimeUtility::current_time();
+      join_filter_ctx->is_ready_ = true;
+    }
+    is_bypass = !join_filter_ctx->is_ready_;
+  }
+  return ret;
+}
+
+void ObExprJoinFilter::add_bypass_rows(const ObExpr &expr, ObEvalCtx &ctx, const int64_t row_cnt)
+{
+  ObExprJoinFilterContext *join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+      ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_));
+  if (OB_NOT_NULL(join_filter_ctx)) {
+    join_filter_ctx->n_times_ += row_cnt;
+    join_filter_ctx->total_count_ += row_cnt;
+  }
+}
+
 int ObExprJoinFilter::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const
 {
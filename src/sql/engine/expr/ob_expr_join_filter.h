@@ -26,7 +26,8 @@ public:
     public:
       ObExprJoinFilterContext() : ObExprOperatorCtx(), 
           bloom_filter_ptr_(NULL), bf_key_(), filter_count_(0), total_count_(0), check_count_(0),
-          n_times_(0), ready_ts_(0), is_ready_(false), wait_ready_(false) {}
+          n_times_(0), ready_ts_(0), range_filter_count_(0), in_filter_count_(0),
+          is_ready_(false), wait_ready_(false) {}
       virtual ~ObExprJoinFilterContext() {} 
       void reset_monitor_info();
       ObPxBloomFilter *bloom_filter_ptr_;
@@ -36,6 +37,9 @@ public:
       int64_t check_count_;
       int64_t n_times_;
       int64_t ready_ts_;
+      // rows filtered by min/max range and by in-list, part of filter_count_
+      int64_t range_filter_count_;
+      int64_t in_filter_count_;
       bool is_ready_;
       bool wait_ready_;
   };
@@ -50,16 +54,49 @@ public:
   static int eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
   static int eval_bloom_filter_batch(
              const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip, const int64_t batch_size);
+  // Before the bloom filter arrives every row passes the join filter, storage checks it ahead
+  // of a micro block and skips decoding the filter columns, see ObBlackFilterExecutor.
+  static int check_bypass(const ObExpr &expr, ObEvalCtx &ctx, bool &is_bypass);
+  static void add_bypass_rows(const ObExpr &expr, ObEvalCtx &ctx, const int64_t row_cnt);
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual bool need_rt_ctx() const override { return true; }
   // hard code seed, 32 bit max prime number
   static const int64_t JOIN_FILTER_SEED = 4294967279;
+private:
+  static bool need_check_range(const ObExpr &expr, const ObPxBloomFilter &filter);
+  static int check_contain(ObExprJoinFilterContext &join_filter_ctx,
+                           const common::ObDatum *range_key,
+                           const uint64_t hash,
+                           bool &is_match);
 private:
   static const int64_t CHECK_TIMES = 127;
   DISALLOW_COPY_AND_ASSIGN(ObExprJoinFilter);
 };
 
+// The range rejects a row at almost no cost, the exact in-list replaces the bloom filter
+// if the build side has few distinct keys, bloom filter is the last choice.
+OB_INLINE int ObExprJoinFilter::check_contain(ObExprJoinFilterContext &join_filter_ctx,
+                                              const common::ObDatum *range_key,
+                                              const uint64_t hash,
+                                              bool &is_match)
+{
+  int ret = OB_SUCCESS;
+  ObPxBloomFilter *filter = join_filter_ctx.bloom_filter_ptr_;
+  is_match = true;
+  if (OB_NOT_NULL(range_key) && !range_key->is_null()
+      && !filter->in_range(range_key->get_int())) {
+    is_match = false;
+    ++join_filter_ctx.range_filter_count_;
+  } else if (filter->is_in_list_valid()) {
+    is_match = filter->in_list_contain(hash);
+    join_filter_ctx.in_filter_count_ += !is_match;
+  } else if (OB_FAIL(filter->might_contain(hash, is_match))) {
+    SQL_ENG_LOG(WARN, "fail to check filter might contain value", K(ret), K(hash));
+  }
+  return ret;
+}
+
 }
 }
 
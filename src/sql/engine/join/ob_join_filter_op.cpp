@@ -231,6 +231,9 @@ int ObJoinFilterOp::inner_open()
       ret = OB_NOT_INIT;
       LOG_WARN("the bloom filter is not init", K(ret));
     }
+    if (OB_SUCC(ret) && MY_SPEC.need_range_filter()) {
+      filter_create_->enable_range();
+    }
     if (OB_SUCC(ret) && MY_SPEC.max_batch_size_ > 0) {
       if (OB_ISNULL(batch_hash_values_ =
               (uint64_t *)ctx_.get_allocator().alloc(sizeof(uint64_t) * MY_SPEC.max_batch_size_))) {
@@ -366,6 +369,10 @@ int ObJoinFilterOp::inner_get_next_row()
       op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::JOIN_FILTER_TOTAL_COUNT;
       op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::JOIN_FILTER_CHECK_COUNT;
       op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::JOIN_FILTER_READY_TIMESTAMP;
+      op_monitor_info_.otherstat_5_value_ = filter_expr_ctx->range_filter_count_;
+      op_monitor_info_.otherstat_6_value_ = filter_expr_ctx->in_filter_count_;
+      op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::JOIN_FILTER_RANGE_FILTERED_COUNT;
+      op_monitor_info_.otherstat_6_id_ = ObSqlMonitorStatIds::JOIN_FILTER_IN_FILTERED_COUNT;
     }
   }
   return ret;
@@ -433,6 +440,10 @@ int ObJoinFilterOp::inner_get_next_batch(const int64_t max_row_cnt)
         op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::JOIN_FILTER_TOTAL_COUNT;
         op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::JOIN_FILTER_CHECK_COUNT;
         op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::JOIN_FILTER_READY_TIMESTAMP;
+        op_monitor_info_.otherstat_5_value_ = filter_expr_ctx->range_filter_count_;
+        op_monitor_info_.otherstat_6_value_ = filter_expr_ctx->in_filter_count_;
+        op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::JOIN_FILTER_RANGE_FILTERED_COUNT;
+        op_monitor_info_.otherstat_6_id_ = ObSqlMonitorStatIds::JOIN_FILTER_IN_FILTERED_COUNT;
       }
     }
   }
@@ -579,6 +590,11 @@ int ObJoinFilterOp::insert_by_row()
     /*do nothing*/
   } else if (OB_FAIL(filter_create_->put(hash_value))) {
     LOG_WARN("fail to put  hash value to px bloom filter", K(ret));
+  } else if (filter_create_->has_range()) {
+    const ObDatum &key = MY_SPEC.join_keys_.at(0)->locate_expr_datum(eval_ctx_);
+    if (!key.is_null()) {
+      filter_create_->put_range(key.get_int());
+    }
   }
   return ret;
 }
@@ -620,6 +636,10 @@ int ObJoinFilterOp::insert_by_row_batch(const ObBatchRows *child_brs)
         }
       }
     }
+    const bool has_range = filter_create_->has_range();
+    const ObDatum *keys = has_range
+        ? MY_SPEC.join_keys_.at(0)->locate_batch_datums(eval_ctx_) : NULL;
+    const bool is_batch_key = has_range && MY_SPEC.join_keys_.at(0)->is_batch_result();
     for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
       if (MY_SPEC.is_partition_filter()) {
         ObDatum &datum = MY_SPEC.calc_tablet_id_expr_->locate_expr_datum(eval_ctx_, i);
@@ -632,6 +652,8 @@ int ObJoinFilterOp::insert_by_row_batch(const ObBatchRows *child_brs)
           continue;
         } else if (OB_FAIL(filter_create_->put(batch_hash_values_[i]))) {
           LOG_WARN("fail to put  hash value to px bloom filter", K(ret));
+        } else if (has_range && !keys[is_batch_key ? i : 0].is_null()) {
+          filter_create_->put_range(keys[is_batch_key ? i : 0].get_int());
         }
       }
     }
@@ -111,6 +111,10 @@ public:
   { return filter_type_ == JoinFilterType::NONSHARED_PARTITION_JOIN_FILTER ||
            filter_type_ == JoinFilterType::SHARED_PARTITION_JOIN_FILTER; };
   inline void set_filter_type(JoinFilterType type) { filter_type_ = type; }
+  // min/max range is built along with bloom filter for a single integer join key
+  inline bool need_range_filter() const
+  { return !is_partition_filter() && 1 == join_keys_.count() &&
+           common::ObIntTC == common::ob_obj_type_class(join_keys_.at(0)->datum_meta_.type_); }
   inline bool is_shared_join_filter() const
   { return filter_type_ == JoinFilterType::SHARED_JOIN_FILTER ||
            filter_type_ == JoinFilterType::SHARED_PARTITION_JOIN_FILTER; }
@@ -118,7 +118,8 @@ ObPhysicalPlan::ObPhysicalPlan(MemoryContext &mem_context /* = CURRENT_CONTEXT *
     ddl_execution_id_(0),
     ddl_task_id_(0),
     is_packed_(false),
-    has_instead_of_trigger_(false)
+    has_instead_of_trigger_(false),
+    reoptimize_start_ts_(0)
 {
 }
 
@@ -200,6 +201,7 @@ void ObPhysicalPlan::reset()
   contain_pl_udf_or_trigger_ = false;
   is_packed_ = false;
   has_instead_of_trigger_ = false;
+  reoptimize_start_ts_ = 0;
   stat_.expected_worker_map_.destroy();
   stat_.minimal_worker_map_.destroy();
 }
@@ -1078,17 +1080,13 @@ int ObPhysicalPlan::update_cache_obj_stat(ObILibCacheCtx &ctx)
     stat_.slowest_exec_usec_ = 0;
     if (pc_ctx.is_ps_mode_) {
       ObTruncatedString trunc_stmt(pc_ctx.raw_sql_, OB_MAX_SQL_LENGTH);
-      if (OB_FAIL(ob_write_string(get_allocator(),
-                                  trunc_stmt.string(),
-                                  stat_.stmt_))) {
+      if (OB_FAIL(write_shared_string(trunc_stmt.string(), stat_.stmt_))) {
         SQL_PC_LOG(WARN, "fail to set turncate string", K(ret));
       }
       stat_.ps_stmt_id_ = pc_ctx.fp_result_.pc_key_.key_id_;
     } else {
       ObTruncatedString trunc_stmt(pc_ctx.sql_ctx_.spm_ctx_.bl_key_.constructed_sql_, OB_MAX_SQL_LENGTH);
-      if (OB_FAIL(ob_write_string(get_allocator(),
-                                  trunc_stmt.string(),
-                                  stat_.stmt_))) {
+      if (OB_FAIL(write_shared_string(trunc_stmt.string(), stat_.stmt_))) {
         SQL_PC_LOG(WARN, "fail to set turncate string", K(ret));
       }
     }
@@ -1097,23 +1095,21 @@ int ObPhysicalPlan::update_cache_obj_stat(ObILibCacheCtx &ctx)
     stat_.delayed_px_querys_= 0;
     stat_.outline_version_ = get_outline_state().outline_version_.version_;
     stat_.outline_id_ = get_outline_state().outline_version_.object_id_;
-    // Truncate the raw sql to avoid the plan memory being too large due to the long raw sql
+    // Truncate the raw sql to avoid the plan memory being too large due to the long raw sql.
+    // The sql texts, sys vars and configs are the same for plans of one statement,
+    // they are shared between plans instead of copied into each plan.
     ObTruncatedString trunc_raw_sql(pc_ctx.raw_sql_, OB_MAX_SQL_LENGTH);
     if (OB_FAIL(pc_ctx.get_not_param_info_str(get_allocator(), stat_.sp_info_str_))) {
       SQL_PC_LOG(WARN, "fail to get special param info string", K(ret));
-    } else if (OB_FAIL(ob_write_string(get_allocator(),
-                                       pc_ctx.fp_result_.pc_key_.sys_vars_str_,
-                                       stat_.sys_vars_str_))) {
+    } else if (OB_FAIL(write_shared_string(pc_ctx.fp_result_.pc_key_.sys_vars_str_,
+                                           stat_.sys_vars_str_))) {
       SQL_PC_LOG(DEBUG, "succeed to add plan statistic", "plan_id", get_plan_id(), K(ret));
-    } else if (OB_FAIL(ob_write_string(get_allocator(),
-                                       pc_ctx.fp_result_.pc_key_.config_str_,
-                                       stat_.config_str_))) {
+    } else if (OB_FAIL(write_shared_string(pc_ctx.fp_result_.pc_key_.config_str_,
+                                           stat_.config_str_))) {
       SQL_PC_LOG(DEBUG, "failed to add plan statistic", "plan_id", get_plan_id(), K(ret));
     } else if (OB_FAIL(init_params_info_str())) {
       SQL_PC_LOG(DEBUG, "fail to gen param info str", K(ret));
-    } else if (OB_FAIL(ob_write_string(get_allocator(),
-                                       trunc_raw_sql.string(),
-                                       stat_.raw_sql_))) {
+    } else if (OB_FAIL(write_shared_string(trunc_raw_sql.string(), stat_.raw_sql_))) {
       SQL_PC_LOG(DEBUG, "fail to copy raw sql", "plan_id", get_plan_id(), K(ret));
     } else {
       stat_.sql_cs_type_ = pc_ctx.sql_ctx_.session_info_->get_local_collation_connection();
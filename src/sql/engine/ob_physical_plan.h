@@ -94,6 +94,9 @@ public:
   static const int64_t SLOW_QUERY_SAMPLE_SIZE = 20; // smaller than ObPlanStat::MAX_SCAN_STAT_SIZE
   static const int64_t TABLE_ROW_CHANGE_THRESHOLD = 2;
   static const int64_t EXPIRED_PLAN_TABLE_ROW_THRESHOLD = 100;
+  // an expired plan hit more than this keeps serving until its replacement is added
+  static const int64_t HOT_PLAN_HIT_COUNT = 100;
+  static const int64_t REOPTIMIZE_TIMEOUT = 10 * 1000 * 1000; // 10s
   OB_UNIS_VERSION(1);
 public:
   explicit ObPhysicalPlan(lib::MemoryContext &mem_context = CURRENT_CONTEXT);
@@ -147,6 +150,13 @@ public:
                         const int64_t sample_exec_usec);
   bool is_expired() const { return stat_.is_expired_; }
   void set_is_expired(bool expired) { stat_.is_expired_ = expired; }
+  bool is_hot() const { return ATOMIC_LOAD(&stat_.hit_count_) >= HOT_PLAN_HIT_COUNT; }
+  // only one query re-optimizes an expired hot plan, returns false if another one is doing it
+  bool try_begin_reoptimize(const int64_t cur_ts)
+  {
+    return ATOMIC_BCAS(&reoptimize_start_ts_, 0, cur_ts);
+  }
+  int64_t get_reoptimize_start_ts() const { return ATOMIC_LOAD(&reoptimize_start_ts_); }
   void inc_large_querys();
   void inc_delayed_large_querys();
   void inc_delayed_px_querys();
@@ -589,6 +599,8 @@ public:
   //parallel encoding of output_expr in advance to speed up packet response
   bool is_packed_;
   bool has_instead_of_trigger_; // mask if has instead of trigger on view
+  // when the query replacing this expired plan started, 0 if not started
+  int64_t reoptimize_start_ts_;
 };
 
 inline void ObPhysicalPlan::set_affected_last_insert_id(bool affected_last_insert_id)
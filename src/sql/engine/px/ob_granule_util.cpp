@@ -265,9 +265,24 @@ int ObGranuleUtil::split_block_granule(ObIAllocator &allocator,
   // 5. calc task ranges for each partition, and get the result
   if (OB_SUCC(ret)) {
     int64_t tablet_idx = 0;
+    // the shared pool hands out tasks in order, the last tasks are split finer so that the
+    // workers finishing the tail of the scan at different time wait less for each other.
+    // the order of tasks is random when range independent, so there is no tail to refine.
+    int64_t tail_task_cnt = 0;
+    int64_t left_task_cnt = 0;
+    if (!range_independent && parallelism > 1) {
+      tail_task_cnt = min(parallelism, esti_task_cnt_by_data_size * TAIL_TASK_PERCENT / 100);
+      for (int i = 0; i < task_cnt_each_partitions.count(); i++) {
+        left_task_cnt += task_cnt_each_partitions.at(i);
+      }
+    }
     for (int i = 0; i < tablets.count() && OB_SUCC(ret); i++) {
       ObDASTabletLoc *tablet = tablets.at(i);
       int64_t expected_task_cnt = task_cnt_each_partitions.at(i);
+      // tail tasks of this partition = tail tasks not covered by the following partitions
+      left_task_cnt -= expected_task_cnt;
+      int64_t partition_tail_task_cnt =
+          max(0L, min(expected_task_cnt, tail_task_cnt - left_task_cnt));
       // split input ranges to n task by PG interface
       if (need_convert_new_range &&
           OB_FAIL(convert_new_range_to_store_range(allocator,
@@ -279,6 +294,7 @@ int ObGranuleUtil::split_block_granule(ObIAllocator &allocator,
         LOG_WARN("failed to convert new range to store range", K(ret));
       } else if (OB_FAIL(get_tasks_for_partition(allocator,
                                                  expected_task_cnt,
+                                                 partition_tail_task_cnt,
                                                  *tablet,
                                                  input_store_ranges,
                                                  granule_tablets,
@@ -410,6 +426,7 @@ int ObGranuleUtil::compute_task_count_each_partition(int64_t total_size,
 
 int ObGranuleUtil::get_tasks_for_partition(ObIAllocator &allocator,
                                            int64_t expected_task_cnt,
+                                           int64_t tail_task_cnt,
                                            ObDASTabletLoc &tablet,
                                            ObIArray<ObStoreRange> &input_storage_ranges,
                                            common::ObIArray<ObDASTabletLoc*> &granule_tablets,
@@ -421,10 +438,10 @@ int ObGranuleUtil::get_tasks_for_partition(ObIAllocator &allocator,
   int ret = OB_SUCCESS;
   ObAccessService *access_service = MTL(ObAccessService *);
   ObArrayArray<ObStoreRange> multi_range_split_array;
-  if (expected_task_cnt < 1) {
+  if (expected_task_cnt < 1 || tail_task_cnt < 0 || tail_task_cnt > expected_task_cnt) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid arg", K(ret), K(expected_task_cnt));
-  } else if (expected_task_cnt == 1) {
+    LOG_WARN("invalid arg", K(ret), K(expected_task_cnt), K(tail_task_cnt));
+  } else if (expected_task_cnt == 1 && tail_task_cnt == 0) {
     // no need to split the input_ranges, if the expected count of task.
     for (int i = 0; i < input_storage_ranges.count() && OB_SUCC(ret); i++) {
       ObNewRange new_range;
@@ -445,41 +462,82 @@ int ObGranuleUtil::get_tasks_for_partition(ObIAllocator &allocator,
   } else if (OB_FAIL(access_service->split_multi_ranges(tablet.ls_id_,
                                                         tablet.tablet_id_,
                                                         input_storage_ranges,
-                                                        expected_task_cnt,
+                                                        // the only task is a tail task
+                                                        expected_task_cnt == 1 ?
+                                                        TAIL_TASK_SPLIT_CNT : expected_task_cnt,
                                                         allocator,
                                                         multi_range_split_array))) {
     LOG_WARN("failed to split multi ranges", K(ret), K(tablet), K(expected_task_cnt));
   } else {
     LOG_TRACE("split multi ranges",
-      K(ret), K(tablet), K(input_storage_ranges),
+      K(ret), K(tablet), K(input_storage_ranges), K(tail_task_cnt),
       K(expected_task_cnt == multi_range_split_array.count()), K(multi_range_split_array));
-    // convert ObStoreRange array to ObNewRange array
-    for (int i = 0; i < multi_range_split_array.count() && OB_SUCC(ret); i++) {
+    const int64_t first_tail_task = expected_task_cnt == 1 ?
+        multi_range_split_array.count() : multi_range_split_array.count() - tail_task_cnt;
+    for (int64_t i = 0; i < multi_range_split_array.count() && OB_SUCC(ret); i++) {
       ObIArray<ObStoreRange> &storage_task_ranges = multi_range_split_array.at(i);
-      for (int j = 0; j < storage_task_ranges.count() && OB_SUCC(ret); j++) {
-        ObNewRange new_range;
-        storage_task_ranges.at(j).to_new_range(new_range);
-        if (OB_INVALID_INDEX == new_range.table_id_) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("invalid table id", K(ret), K(new_range), K(multi_range_split_array.at(i)));
-        } else if (OB_FAIL(granule_tablets.push_back(&tablet))) {
-          LOG_WARN("failed to push back tablet", K(ret), K(tablet));
-        } else  if (OB_FAIL(granule_ranges.push_back(new_range))) {
-          LOG_WARN("failed to push back new task range", K(ret), K(new_range));
-        } else if (OB_FAIL(granule_idx.push_back(tablet_idx))) {
-          LOG_WARN("failed to push back idx", K(ret), K(tablet_idx));
-        } else if (range_independent) {
-          tablet_idx++;
+      if (i < first_tail_task || storage_task_ranges.count() < 1) {
+        if (OB_FAIL(append_task_ranges(tablet, storage_task_ranges, granule_tablets,
+                                       granule_ranges, granule_idx, tablet_idx,
+                                       range_independent))) {
+          LOG_WARN("failed to append task ranges", K(ret));
+        }
+      } else {
+        // split the tail task again, the sub tasks keep the order of the ranges
+        ObArrayArray<ObStoreRange> tail_split_array;
+        if (OB_FAIL(access_service->split_multi_ranges(tablet.ls_id_,
+                                                       tablet.tablet_id_,
+                                                       storage_task_ranges,
+                                                       TAIL_TASK_SPLIT_CNT,
+                                                       allocator,
+                                                       tail_split_array))) {
+          LOG_WARN("failed to split tail task", K(ret), K(tablet), K(storage_task_ranges));
+        }
+        for (int64_t j = 0; j < tail_split_array.count() && OB_SUCC(ret); j++) {
+          if (OB_FAIL(append_task_ranges(tablet, tail_split_array.at(j), granule_tablets,
+                                         granule_ranges, granule_idx, tablet_idx,
+                                         range_independent))) {
+            LOG_WARN("failed to append task ranges", K(ret));
+          }
         }
-      }
-      if (!range_independent) {
-        tablet_idx++;
       }
     }
   }
   return ret;
 }
 
+int ObGranuleUtil::append_task_ranges(ObDASTabletLoc &tablet,
+                                      const ObIArray<ObStoreRange> &storage_task_ranges,
+                                      common::ObIArray<ObDASTabletLoc*> &granule_tablets,
+                                      common::ObIArray<common::ObNewRange> &granule_ranges,
+                                      common::ObIArray<int64_t> &granule_idx,
+                                      int64_t &tablet_idx,
+                                      bool range_independent)
+{
+  int ret = OB_SUCCESS;
+  // convert ObStoreRange array to ObNewRange array
+  for (int64_t j = 0; j < storage_task_ranges.count() && OB_SUCC(ret); j++) {
+    ObNewRange new_range;
+    storage_task_ranges.at(j).to_new_range(new_range);
+    if (OB_INVALID_INDEX == new_range.table_id_) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("invalid table id", K(ret), K(new_range), K(storage_task_ranges));
+    } else if (OB_FAIL(granule_tablets.push_back(&tablet))) {
+      LOG_WARN("failed to push back tablet", K(ret), K(tablet));
+    } else  if (OB_FAIL(granule_ranges.push_back(new_range))) {
+      LOG_WARN("failed to push back new task range", K(ret), K(new_range));
+    } else if (OB_FAIL(granule_idx.push_back(tablet_idx))) {
+      LOG_WARN("failed to push back idx", K(ret), K(tablet_idx));
+    } else if (range_independent) {
+      tablet_idx++;
+    }
+  }
+  if (!range_independent) {
+    tablet_idx++;
+  }
+  return ret;
+}
+
 int ObGranuleUtil::convert_new_range_to_store_range(ObIAllocator &allocator,
                                                     const ObTableScanSpec *tsc,
                                                     const ObTabletID &tablet_id,
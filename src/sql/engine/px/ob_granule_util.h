@@ -144,6 +144,11 @@ struct ObParallelBlockRangeTaskParams
 
 class ObGranuleUtil
 {
+public:
+  // the last TAIL_TASK_PERCENT% tasks (at most parallelism tasks) of block granule are
+  // split into TAIL_TASK_SPLIT_CNT smaller tasks each
+  static const int64_t TAIL_TASK_PERCENT = 10;
+  static const int64_t TAIL_TASK_SPLIT_CNT = 4;
 public:
   /**
    *  table_partition_info  IN    partition info
@@ -252,6 +257,7 @@ private:
    * get the splitted tasks for each partition
    * allocator                   IN  memory allocator
    * expected_task_cnt           IN  the expected count of tasks for this partition
+   * tail_task_cnt               IN  the count of the last tasks to be split finer
    * pkey                        IN  the identifier for partition
    * partition_service           IN  utils for splitting tasks
    * input_storage_ranges        IN  query ranges extracted in optimizer stage
@@ -264,6 +270,7 @@ private:
    */
   static int get_tasks_for_partition(common::ObIAllocator &allocator,
                                      int64_t expected_task_cnt,
+                                     int64_t tail_task_cnt,
                                      ObDASTabletLoc &tablet,
                                      common::ObIArray<common::ObStoreRange> &input_storage_ranges,
                                      common::ObIArray<ObDASTabletLoc*> &tablet_array,
@@ -272,6 +279,15 @@ private:
                                      int64_t &pkey_idx,
                                      bool range_independent);
 
+  // append the ranges of one task to the granules
+  static int append_task_ranges(ObDASTabletLoc &tablet,
+                                const common::ObIArray<common::ObStoreRange> &storage_task_ranges,
+                                common::ObIArray<ObDASTabletLoc*> &granule_tablets,
+                                common::ObIArray<common::ObNewRange> &granule_ranges,
+                                common::ObIArray<int64_t> &granule_idx,
+                                int64_t &tablet_idx,
+                                bool range_independent);
+
   static int convert_new_range_to_store_range(common::ObIAllocator &allocator,
                                               const ObTableScanSpec *tsc,
                                               const common::ObTabletID &tablet_id,
@@ -37,7 +37,9 @@ using namespace obrpc;
 
 ObPxBloomFilter::ObPxBloomFilter() : data_length_(0), bits_count_(0), fpp_(0.0),
     hash_func_count_(0), is_inited_(false), bits_array_length_(0),
-    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), allocator_(), lock_(),
+    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), might_contain_(NULL),
+    in_list_capacity_(0), in_list_slots_(NULL), in_list_count_(0), in_list_overflow_(false),
+    has_range_(false), min_val_(INT64_MAX), max_val_(INT64_MIN), allocator_(), lock_(),
     px_bf_recieve_count_(0), px_bf_recieve_size_(0), px_bf_merge_filter_count_(0)
 {
 
@@ -69,14 +71,36 @@ int ObPxBloomFilter::init(int64_t data_length, ObIAllocator &allocator, double f
                             + CACHE_LINE_SIZE - 1) >> LOG_CACHE_LINE_SIZE) << LOG_CACHE_LINE_SIZE;
       bits_array_ = reinterpret_cast<int64_t *>(align_addr);
       MEMSET(bits_array_, 0, bits_array_length_ * sizeof(int64_t));
-      is_inited_ = true;
-      LOG_TRACE("init px bloom filter", K(data_length_), K(bits_array_buf),
-                 K(bits_array_), K(hash_func_count_), K(simd_support));
+      if (OB_FAIL(init_in_list(allocator))) {
+        LOG_WARN("fail to init in list", K(ret));
+      } else {
+        is_inited_ = true;
+        LOG_TRACE("init px bloom filter", K(data_length_), K(bits_array_buf),
+                   K(bits_array_), K(hash_func_count_), K(simd_support));
+      }
     }
   }
   return ret;
 }
 
+int ObPxBloomFilter::init_in_list(ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  // at most half full, so that probing ends soon
+  const int64_t capacity = MAX_IN_LIST_COUNT * 2;
+  if (OB_ISNULL(in_list_slots_ = static_cast<uint64_t *>(
+                allocator.alloc(capacity * sizeof(uint64_t))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc px bloom filter in list", K(ret), K(capacity));
+  } else {
+    MEMSET(in_list_slots_, 0, capacity * sizeof(uint64_t));
+    in_list_capacity_ = capacity;
+    in_list_count_ = 0;
+    in_list_overflow_ = false;
+  }
+  return ret;
+}
+
 int ObPxBloomFilter::init(ObPxBloomFilter *filter)
 {
   int ret = OB_SUCCESS;
@@ -93,12 +117,26 @@ int ObPxBloomFilter::init(ObPxBloomFilter *filter)
     bits_array_ = filter->bits_array_;
     true_count_ = filter->true_count_;
     might_contain_ = filter->might_contain_;
+    in_list_capacity_ = filter->in_list_capacity_;
+    in_list_slots_ = filter->in_list_slots_;
+    in_list_count_ = filter->in_list_count_;
+    in_list_overflow_ = filter->in_list_overflow_;
+    has_range_ = filter->has_range_;
+    min_val_ = filter->min_val_;
+    max_val_ = filter->max_val_;
   }
   return ret;
 }
 void ObPxBloomFilter::reset_filter()
 {
   MEMSET(bits_array_, 0, bits_array_length_ * sizeof(int64_t));
+  if (OB_NOT_NULL(in_list_slots_)) {
+    MEMSET(in_list_slots_, 0, in_list_capacity_ * sizeof(uint64_t));
+  }
+  in_list_count_ = 0;
+  in_list_overflow_ = false;
+  min_val_ = INT64_MAX;
+  max_val_ = INT64_MIN;
   px_bf_recieve_count_ = 0;
   px_bf_recieve_size_ = 0;
 }
@@ -144,9 +182,76 @@ int ObPxBloomFilter::put(uint64_t hash)
     (void)set(block_begin + 1, 1L << (hash_high >> 8));
     (void)set(block_begin + 2, 1L << (hash_high >> 16));
     (void)set(block_begin + 3, 1L << (hash_high >> 24));
+    (void)put_in_list(hash);
   }
   return ret;
 }
+
+// lock free insert, workers of a shared join filter put concurrently
+void ObPxBloomFilter::put_in_list(uint64_t hash)
+{
+  if (in_list_capacity_ > 0 && !ATOMIC_LOAD(&in_list_overflow_)) {
+    // 0 marks an empty slot, hash 0 shares the slot of 1, which is a harmless false positive
+    const uint64_t key = (0 == hash) ? 1 : hash;
+    const uint64_t mask = in_list_capacity_ - 1;
+    uint64_t pos = key & mask;
+    bool finish = false;
+    for (int64_t probe_cnt = 0; !finish && probe_cnt < in_list_capacity_; ) {
+      uint64_t old_v = ATOMIC_LOAD(&in_list_slots_[pos]);
+      if (key == old_v) {
+        finish = true;
+      } else if (0 != old_v) {
+        pos = (pos + 1) & mask;
+        ++probe_cnt;
+      } else if (0 == ATOMIC_CAS(&in_list_slots_[pos], 0, key)) {
+        if (ATOMIC_AAF(&in_list_count_, 1) > MAX_IN_LIST_COUNT) {
+          ATOMIC_STORE(&in_list_overflow_, true);
+        }
+        finish = true;
+      }
+      // else the slot is taken by another worker just now, check it again
+    }
+    if (!finish) {
+      ATOMIC_STORE(&in_list_overflow_, true);
+    }
+  }
+}
+
+bool ObPxBloomFilter::in_list_contain(uint64_t hash) const
+{
+  bool is_match = false;
+  const uint64_t key = (0 == hash) ? 1 : hash;
+  const uint64_t mask = in_list_capacity_ - 1;
+  uint64_t pos = key & mask;
+  bool finish = false;
+  for (int64_t probe_cnt = 0; !finish && probe_cnt < in_list_capacity_; ++probe_cnt) {
+    if (key == in_list_slots_[pos]) {
+      is_match = true;
+      finish = true;
+    } else if (0 == in_list_slots_[pos]) {
+      finish = true;
+    } else {
+      pos = (pos + 1) & mask;
+    }
+  }
+  return is_match;
+}
+
+void ObPxBloomFilter::put_range(int64_t val)
+{
+  merge_range(val, val);
+}
+
+void ObPxBloomFilter::merge_range(int64_t min_val, int64_t max_val)
+{
+  int64_t old_v = 0;
+  while (min_val < (old_v = ATOMIC_LOAD(&min_val_))
+         && ATOMIC_CAS(&min_val_, old_v, min_val) != old_v) {
+  }
+  while (max_val > (old_v = ATOMIC_LOAD(&max_val_))
+         && ATOMIC_CAS(&max_val_, old_v, max_val) != old_v) {
+  }
+}
 int ObPxBloomFilter::put_batch(ObPxBFHashArray &hash_val_array)
 {
   int ret = OB_SUCCESS;
@@ -203,6 +308,21 @@ int ObPxBloomFilter::merge_filter(ObPxBloomFilter *filter)
         new_v = old_v | filter->bits_array_[i];
       } while(ATOMIC_CAS(&bits_array_[i + filter->begin_idx_], old_v, new_v) != old_v);
     }
+    if (filter->carry_in_list_and_range()) {
+      if (!filter->is_in_list_valid()) {
+        ATOMIC_STORE(&in_list_overflow_, true);
+      } else {
+        for (int64_t i = 0; i < filter->in_list_capacity_; ++i) {
+          if (0 != filter->in_list_slots_[i]) {
+            (void)put_in_list(filter->in_list_slots_[i]);
+          }
+        }
+      }
+      if (filter->has_range_) {
+        (void)merge_range(filter->min_val_, filter->max_val_);
+        has_range_ = true;
+      }
+    }
   }
   return ret;
 }
@@ -320,6 +440,20 @@ OB_DEF_SERIALIZE(ObPxBloomFilter)
       LOG_WARN("fail to encode bits data", K(ret), K(bits_array_[i]));
     }
   }
+  if (OB_SUCC(ret) && carry_in_list_and_range()) {
+    const int64_t in_list_cnt = get_in_list_encode_count();
+    LST_DO_CODE(OB_UNIS_ENCODE,
+                has_range_,
+                min_val_,
+                max_val_,
+                in_list_cnt);
+    for (int64_t i = 0; OB_SUCC(ret) && in_list_cnt > 0 && i < in_list_capacity_; ++i) {
+      if (0 != in_list_slots_[i]
+          && OB_FAIL(serialization::encode(buf, buf_len, pos, in_list_slots_[i]))) {
+        LOG_WARN("fail to encode in list data", K(ret), K(in_list_slots_[i]));
+      }
+    }
+  }
   return ret;
 }
 
@@ -358,6 +492,29 @@ OB_DEF_DESERIALIZE(ObPxBloomFilter)
                        : &ObPxBloomFilter::might_contain_nonsimd;
     }
   }
+  if (OB_SUCC(ret) && carry_in_list_and_range()) {
+    // -1 means the sender has no valid in list
+    int64_t in_list_cnt = -1;
+    LST_DO_CODE(OB_UNIS_DECODE,
+                has_range_,
+                min_val_,
+                max_val_,
+                in_list_cnt);
+    if (OB_FAIL(ret) || in_list_cnt < 0) {
+      in_list_overflow_ = true;
+    } else if (OB_FAIL(init_in_list(allocator_))) {
+      LOG_WARN("fail to init in list", K(ret));
+    } else {
+      uint64_t hash = 0;
+      for (int64_t i = 0; OB_SUCC(ret) && i < in_list_cnt; ++i) {
+        if (OB_FAIL(serialization::decode(buf, data_len, pos, hash))) {
+          LOG_WARN("fail to decode in list data", K(ret));
+        } else {
+          (void)put_in_list(hash);
+        }
+      }
+    }
+  }
   return ret;
 }
 
@@ -377,9 +534,34 @@ OB_DEF_SERIALIZE_SIZE(ObPxBloomFilter)
   for (int i = begin_idx_; i <= end_idx_; ++i) {
     len += serialization::encoded_length(bits_array_[i]);
   }
+  if (carry_in_list_and_range()) {
+    const int64_t in_list_cnt = get_in_list_encode_count();
+    LST_DO_CODE(OB_UNIS_ADD_LEN,
+                has_range_,
+                min_val_,
+                max_val_,
+                in_list_cnt);
+    for (int64_t i = 0; in_list_cnt > 0 && i < in_list_capacity_; ++i) {
+      if (0 != in_list_slots_[i]) {
+        len += serialization::encoded_length(in_list_slots_[i]);
+      }
+    }
+  }
   return len;
 }
 
+int64_t ObPxBloomFilter::get_in_list_encode_count() const
+{
+  int64_t cnt = -1;
+  if (is_in_list_valid()) {
+    cnt = 0;
+    for (int64_t i = 0; i < in_list_capacity_; ++i) {
+      cnt += (0 != in_list_slots_[i]);
+    }
+  }
+  return cnt;
+}
+
  void ObPxBloomFilter::dump_filter()
  {
    LOG_INFO("dump px bloom filter info:", K(*this));
@@ -67,6 +67,14 @@ public:
   int put(uint64_t hash);
   int put_batch(ObPxBFHashArray &hash_val_array);
   int merge_filter(ObPxBloomFilter *filter);
+  // exact hash set of the join key, valid while the build side has few distinct keys
+  bool is_in_list_valid() const { return in_list_capacity_ > 0 && !in_list_overflow_; }
+  bool in_list_contain(uint64_t hash) const;
+  // min/max range of the join key, only for a single integer join key
+  void enable_range() { has_range_ = true; }
+  bool has_range() const { return has_range_; }
+  void put_range(int64_t val);
+  bool in_range(int64_t val) const { return val >= min_val_ && val <= max_val_; }
   int64_t get_value_true_count() const { return true_count_; };
   void dump_filter();      //for debug
   bool check_ready();
@@ -90,7 +98,8 @@ public:
   int generate_receive_count_array();
   void reset();
   TO_STRING_KV(K_(data_length), K_(bits_count), K_(fpp), K_(hash_func_count), K_(is_inited),
-      K_(bits_array_length), K_(true_count));
+      K_(bits_array_length), K_(true_count), K_(in_list_count), K_(in_list_overflow),
+      K_(has_range), K_(min_val), K_(max_val));
 private:
   bool get(uint64_t pos, uint64_t index) { return (bits_array_[pos] & index) != 0; }
   bool set(uint64_t block_begin, uint64_t index);
@@ -98,6 +107,16 @@ private:
   void calc_num_of_bits();
   int might_contain_nonsimd(uint64_t hash, bool &is_match);
   int might_contain_simd(uint64_t hash, bool &is_match);
+  int init_in_list(common::ObIAllocator &allocator);
+  void put_in_list(uint64_t hash);
+  void merge_range(int64_t min_val, int64_t max_val);
+  // the in-list and range are small, only the slice begins at 0 carries them
+  bool carry_in_list_and_range() const { return 0 == begin_idx_; }
+  int64_t get_in_list_encode_count() const;
+public:
+  // the in-list works as a bloom filter without false positive if the build side has no more
+  // distinct keys, 16KB memory for each filter
+  static const int64_t MAX_IN_LIST_COUNT = 1024;
 
 private:
   int64_t data_length_;          //原始数据长度
@@ -111,6 +130,13 @@ private:
   int64_t begin_idx_;            // join filter begin position
   int64_t end_idx_;              // join filter end position
   GetFunc might_contain_;       // function pointer for might contain
+  int64_t in_list_capacity_;     // slot count of open addressing hash set, power of 2
+  uint64_t *in_list_slots_;      // 0 means empty slot
+  int64_t in_list_count_;
+  bool in_list_overflow_;        // too many distinct keys, fall back to bloom filter
+  bool has_range_;
+  int64_t min_val_;
+  int64_t max_val_;
 private:
   common::ObArenaAllocator allocator_;
   mutable common::ObSpinLock lock_;
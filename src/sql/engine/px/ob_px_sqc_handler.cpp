@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX SQL_ENG
 #include "sql/engine/px/ob_px_sqc_handler.h"
 #include "sql/engine/px/ob_px_admission.h"
+#include "sql/engine/px/ob_granule_iterator_op.h"
 #include "sql/engine/ob_physical_plan_ctx.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/ob_sql.h"
@@ -113,6 +114,15 @@ int ObPxSqcHandler::pre_acquire_px_worker(int64_t &reserved_thread_count)
       sqc_init_args_->sqc_.set_task_count(rpc_worker_count);
     }
   } else {
+    // The dop is decided by optimizer with statistics, which may be stale. A leaf dfo
+    // scanning by partition granules can not keep more workers busy than its granules,
+    // reserve no more threads than that.
+    const int64_t granule_count = get_partition_granule_count();
+    if (granule_count > 0 && granule_count < max_thread_count) {
+      LOG_TRACE("shrink px thread count to granule count", K(max_thread_count), K(granule_count));
+      max_thread_count = granule_count;
+      min_thread_count = MIN(min_thread_count, max_thread_count);
+    }
     // 提前在租户中预留线程数，用于 px worker 执行
     ObPxSubAdmission::acquire(max_thread_count, min_thread_count, reserved_px_thread_count_);
     reserved_px_thread_count_ = reserved_px_thread_count_ < min_thread_count ? 0 : reserved_px_thread_count_;
@@ -144,6 +154,62 @@ int ObPxSqcHandler::pre_acquire_px_worker(int64_t &reserved_thread_count)
   return ret;
 }
 
+int64_t ObPxSqcHandler::get_partition_granule_count() const
+{
+  int ret = OB_SUCCESS;
+  int64_t granule_count = -1;
+  bool has_gi = false;
+  const ObOpSpec *root = sqc_init_args_->op_spec_root_;
+  if (OB_ISNULL(root) || !only_partition_granule(*root, has_gi) || !has_gi) {
+    // do nothing
+  } else {
+    // each tablet is a granule, partition wise scans take one tablet of every table at a time
+    ObIArray<ObSqcTableLocationKey> &keys = sqc_init_args_->sqc_.get_access_table_location_keys();
+    // <table location key, tablet count>
+    ObSEArray<std::pair<int64_t, int64_t>, 4> tablet_cnts;
+    bool has_dml = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !has_dml && i < keys.count(); ++i) {
+      int64_t j = 0;
+      has_dml = keys.at(i).is_dml_;
+      while (j < tablet_cnts.count() && tablet_cnts.at(j).first != keys.at(i).table_location_key_) {
+        ++j;
+      }
+      if (j < tablet_cnts.count()) {
+        ++tablet_cnts.at(j).second;
+      } else if (OB_FAIL(tablet_cnts.push_back(
+                 std::make_pair(keys.at(i).table_location_key_, static_cast<int64_t>(1))))) {
+        LOG_WARN("failed to push back tablet count", K(ret));
+      }
+    }
+    for (int64_t j = 0; OB_SUCC(ret) && !has_dml && j < tablet_cnts.count(); ++j) {
+      granule_count = MAX(granule_count, tablet_cnts.at(j).second);
+    }
+  }
+  return granule_count;
+}
+
+bool ObPxSqcHandler::only_partition_granule(const ObOpSpec &spec, bool &has_gi)
+{
+  bool bret = true;
+  if (IS_PX_RECEIVE(spec.type_) || PHY_TEMP_TABLE_ACCESS == spec.type_) {
+    // rows come from other dfos, the worker count does not depend on local tables
+    bret = false;
+  } else if (PHY_GRANULE_ITERATOR == spec.type_) {
+    const ObGranuleIteratorSpec &gi_spec = static_cast<const ObGranuleIteratorSpec &>(spec);
+    bret = (gi_spec.force_partition_granule() || gi_spec.partition_wise())
+           && !gi_spec.access_all()
+           && !gi_spec.affinitize()
+           && !gi_spec.with_param_down();
+    has_gi = true;
+  }
+  for (int64_t i = 0; bret && i < spec.get_child_cnt(); ++i) {
+    if (OB_NOT_NULL(spec.get_child(i))) {
+      bret = only_partition_granule(*spec.get_child(i), has_gi);
+    }
+  }
+  return bret;
+}
+
 ObPxSqcHandler *ObPxSqcHandler::get_sqc_handler()
 {
   return op_reclaim_alloc(ObPxSqcHandler);
@@ -129,6 +129,9 @@ public:
 private:
   void init_flt_content();
   int destroy_sqc();
+  // the granule count if the dfo only scans tables by partition granules, -1 if unknown
+  int64_t get_partition_granule_count() const;
+  static bool only_partition_granule(const ObOpSpec &spec, bool &has_gi);
 private:
   lib::MemoryContext mem_context_;
   uint64_t tenant_id_;
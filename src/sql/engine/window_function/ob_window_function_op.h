@@ -451,7 +451,11 @@ public:
         result_(),
         got_result_(false),
         remove_type_(wf_info.remove_type_)
-    {}
+    {
+      // the frame restarts when the extremum slides out, the later equal one defers it
+      aggr_processor_.get_removal_info().keep_last_extremum_ =
+          common::REMOVE_EXTRENUM == remove_type_;
+    }
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
     {
@@ -31,10 +31,42 @@ ObILibCacheObject::ObILibCacheObject(ObLibCacheNameSpace ns, lib::MemoryContext
     ns_(ns),
     tenant_id_(OB_INVALID_ID),
     dynamic_ref_handle_(MAX_HANDLE),
-    obj_status_(ObILibCacheObject::ACTIVE)
+    obj_status_(ObILibCacheObject::ACTIVE),
+    fragment_pool_(NULL),
+    shared_fragment_cnt_(0)
 {
 }
 
+ObILibCacheObject::~ObILibCacheObject()
+{
+  if (OB_NOT_NULL(fragment_pool_)) {
+    for (int64_t i = 0; i < shared_fragment_cnt_; ++i) {
+      fragment_pool_->release(shared_fragments_[i]);
+      shared_fragments_[i] = NULL;
+    }
+  }
+  shared_fragment_cnt_ = 0;
+}
+
+int ObILibCacheObject::write_shared_string(const ObString &src, ObString &dst)
+{
+  int ret = OB_SUCCESS;
+  ObLCSharedFragment *fragment = NULL;
+  if (OB_ISNULL(fragment_pool_)
+      || src.length() < ObLCSharedFragmentPool::MIN_SHARED_FRAGMENT_LEN
+      || shared_fragment_cnt_ >= MAX_SHARED_FRAGMENT_COUNT) {
+    if (OB_FAIL(ob_write_string(allocator_, src, dst))) {
+      LOG_WARN("failed to write string", K(ret));
+    }
+  } else if (OB_FAIL(fragment_pool_->acquire(src, fragment))) {
+    LOG_WARN("failed to acquire shared fragment", K(ret));
+  } else {
+    shared_fragments_[shared_fragment_cnt_++] = fragment;
+    dst = fragment->get_content();
+  }
+  return ret;
+}
+
 void ObILibCacheObject::reset()
 {
   ref_count_ = 0;
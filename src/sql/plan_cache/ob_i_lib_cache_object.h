@@ -15,6 +15,7 @@
 
 #include "sql/plan_cache/ob_lib_cache_register.h"
 #include "sql/plan_cache/ob_i_lib_cache_context.h"
+#include "sql/plan_cache/ob_lib_cache_shared_fragment.h"
 
 namespace oceanbase
 {
@@ -38,8 +39,10 @@ public:
     MARK_ERASED = 2
   };
 
+  static const int64_t MAX_SHARED_FRAGMENT_COUNT = 8;
+
   ObILibCacheObject(ObLibCacheNameSpace ns, lib::MemoryContext &mem_context);
-  virtual ~ObILibCacheObject() {}
+  virtual ~ObILibCacheObject();
 
   inline ObLibCacheNameSpace get_ns() const { return ns_; }
   inline void set_ns(ObLibCacheNameSpace ns) { ns_ = ns; }
@@ -68,6 +71,9 @@ public:
   }
   inline void set_obj_status(CacheObjStatus status) { obj_status_ = status; }
   inline CacheObjStatus get_obj_status() const { return obj_status_; }
+  // copy an immutable string into this object, long strings are shared with other
+  // objects through ObLCSharedFragmentPool and must never be modified
+  int write_shared_string(const common::ObString &src, common::ObString &dst);
 
   ///
   /// The following interfaces need to be inherited and implemented by derived classes
@@ -97,6 +103,10 @@ protected:
   uint64_t tenant_id_;
   CacheRefHandleID dynamic_ref_handle_;
   CacheObjStatus obj_status_;
+  // set by ObLCObjectManager::alloc
+  ObLCSharedFragmentPool *fragment_pool_;
+  ObLCSharedFragment *shared_fragments_[MAX_SHARED_FRAGMENT_COUNT];
+  int64_t shared_fragment_cnt_;
 };
 
 
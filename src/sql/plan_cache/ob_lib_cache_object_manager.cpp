@@ -39,6 +39,8 @@ int ObLCObjectManager::init(int64_t hash_bucket, uint64_t tenant_id)
                                                  ObModIds::OB_HASH_NODE_LC_STAT,
                                                  tenant_id))) {
     LOG_WARN("failed to init alloc cache obj map", K(ret));
+  } else if (OB_FAIL(fragment_pool_.init(hash_bucket, tenant_id))) {
+    LOG_WARN("failed to init shared fragment pool", K(ret));
   }
   return ret;
 }
@@ -73,6 +75,7 @@ int ObLCObjectManager::alloc(ObCacheObjGuard& guard,
       } else {
         uint64_t obj_id = allocate_object_id();
         cache_obj->object_id_ = obj_id;
+        cache_obj->fragment_pool_ = &fragment_pool_;
         if (OB_FAIL(alloc_cache_obj_map_.set_refactored(obj_id, cache_obj))) {
           LOG_WARN("failed to add element to hashmap", K(ret));
           inner_free(cache_obj);
@@ -54,6 +54,7 @@ public:
   IdCacheObjectMap &get_cache_obj_map() { return cache_obj_map_; }
   IdCacheObjectMap &get_alloc_cache_obj_map() { return alloc_cache_obj_map_; }
   uint64_t allocate_object_id() { return __sync_add_and_fetch(&object_id_, 1); }
+  const ObLCSharedFragmentPool &get_fragment_pool() const { return fragment_pool_; }
   template<typename ClassT>
   static int alloc(lib::MemoryContext &mem_ctx,
                    ObILibCacheObject *&obj,
@@ -88,6 +89,8 @@ private:
    * memory leak occurs.
    */
   IdCacheObjectMap alloc_cache_obj_map_;
+  // immutable fragments shared by the cache objects, must outlive all of them
+  ObLCSharedFragmentPool fragment_pool_;
 };
 
 template<class _callback>
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include "sql/plan_cache/ob_lib_cache_shared_fragment.h"
+#include "lib/allocator/ob_malloc.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+int ObLCSharedFragmentPool::init(const int64_t hash_bucket, const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(fragment_map_.create(hash::cal_next_prime(hash_bucket),
+                                          "LCSharedFrag",
+                                          "LCSharedFrag",
+                                          tenant_id,
+                                          ObCtxIds::PLAN_CACHE_CTX_ID))) {
+    LOG_WARN("failed to create fragment map", K(ret));
+  } else {
+    tenant_id_ = tenant_id;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObLCSharedFragmentPool::destroy()
+{
+  if (is_inited_) {
+    lib::ObMutexGuard guard(lock_);
+    for (FragmentMap::iterator iter = fragment_map_.begin();
+         iter != fragment_map_.end(); ++iter) {
+      if (OB_NOT_NULL(iter->second)) {
+        LOG_WARN("shared fragment is still referenced", KPC(iter->second));
+        iter->second->~ObLCSharedFragment();
+        ob_free(iter->second);
+      }
+    }
+    fragment_map_.destroy();
+    mem_used_ = 0;
+    mem_saved_ = 0;
+    is_inited_ = false;
+  }
+}
+
+int ObLCSharedFragmentPool::acquire(const ObString &src, ObLCSharedFragment *&fragment)
+{
+  int ret = OB_SUCCESS;
+  fragment = NULL;
+  if (!is_inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (src.empty()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(src));
+  } else {
+    lib::ObMutexGuard guard(lock_);
+    if (OB_FAIL(fragment_map_.get_refactored(src, fragment))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        LOG_WARN("failed to get shared fragment", K(ret));
+      } else {
+        ret = OB_SUCCESS;
+        void *buf = NULL;
+        const int64_t mem_size = sizeof(ObLCSharedFragment) + src.length();
+        if (OB_ISNULL(buf = ob_malloc(mem_size, ObMemAttr(tenant_id_,
+                                                          "LCSharedFrag",
+                                                          ObCtxIds::PLAN_CACHE_CTX_ID)))) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          LOG_WARN("failed to allocate shared fragment", K(ret), K(mem_size));
+        } else {
+          fragment = new (buf) ObLCSharedFragment();
+          fragment->len_ = src.length();
+          MEMCPY(fragment->buf_, src.ptr(), src.length());
+          if (OB_FAIL(fragment_map_.set_refactored(fragment->get_content(), fragment))) {
+            LOG_WARN("failed to add shared fragment", K(ret));
+            fragment->~ObLCSharedFragment();
+            ob_free(buf);
+            fragment = NULL;
+          } else {
+            fragment->ref_cnt_ = 1;
+            ATOMIC_AAF(&mem_used_, mem_size);
+          }
+        }
+      }
+    } else if (OB_ISNULL(fragment)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null fragment", K(ret));
+    } else {
+      ++fragment->ref_cnt_;
+      ATOMIC_AAF(&mem_saved_, fragment->len_);
+    }
+  }
+  return ret;
+}
+
+void ObLCSharedFragmentPool::release(ObLCSharedFragment *fragment)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited_ || OB_ISNULL(fragment)) {
+    // do nothing
+  } else {
+    lib::ObMutexGuard guard(lock_);
+    if (fragment->ref_cnt_ > 1) {
+      --fragment->ref_cnt_;
+      ATOMIC_SAF(&mem_saved_, fragment->len_);
+    } else if (OB_FAIL(fragment_map_.erase_refactored(fragment->get_content()))) {
+      LOG_ERROR("failed to erase shared fragment", K(ret), KPC(fragment));
+    } else {
+      ATOMIC_SAF(&mem_used_, fragment->get_mem_size());
+      fragment->~ObLCSharedFragment();
+      ob_free(fragment);
+    }
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_SHARED_FRAGMENT_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_SHARED_FRAGMENT_
+
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_mutex.h"
+#include "lib/string/ob_string.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// an immutable byte string shared by cache objects, freed when the last reference is released
+struct ObLCSharedFragment
+{
+  ObLCSharedFragment() : ref_cnt_(0), len_(0) {}
+  common::ObString get_content() const { return common::ObString(len_, buf_); }
+  int64_t get_mem_size() const { return sizeof(ObLCSharedFragment) + len_; }
+  TO_STRING_KV(K_(ref_cnt), K_(len));
+
+  int64_t ref_cnt_;
+  int32_t len_;
+  char buf_[0];
+};
+
+/**
+ * @brief dedups immutable fragments of lib cache objects by content.
+ *        Near-identical plans of a statement (different param types, local and distributed
+ *        plans, different partitions) carry the same sql text, sys vars and configs,
+ *        each of them keeps a reference to the one copy in the pool instead of its own.
+ *        Fragments are acquired when the object is added to plan cache and released
+ *        when the object is destroyed, see ObILibCacheObject::write_shared_string.
+ */
+class ObLCSharedFragmentPool
+{
+public:
+  // shorter strings are cheaper to copy than to share
+  static const int64_t MIN_SHARED_FRAGMENT_LEN = 64;
+public:
+  ObLCSharedFragmentPool()
+    : is_inited_(false), tenant_id_(common::OB_INVALID_TENANT_ID), lock_(),
+      fragment_map_(), mem_used_(0), mem_saved_(0)
+  {}
+  ~ObLCSharedFragmentPool() { destroy(); }
+  int init(const int64_t hash_bucket, const uint64_t tenant_id);
+  void destroy();
+  // returns the fragment with the same content as src, created if absent, ref count inc by 1
+  int acquire(const common::ObString &src, ObLCSharedFragment *&fragment);
+  void release(ObLCSharedFragment *fragment);
+  int64_t get_fragment_count() const { return fragment_map_.size(); }
+  // memory held by the fragments
+  int64_t get_mem_used() const { return ATOMIC_LOAD(&mem_used_); }
+  // memory the cache objects would have used to hold their own copies
+  int64_t get_mem_saved() const { return ATOMIC_LOAD(&mem_saved_); }
+  TO_STRING_KV(K_(is_inited), K_(tenant_id), K_(mem_used), K_(mem_saved));
+private:
+  typedef common::hash::ObHashMap<common::ObString,
+                                  ObLCSharedFragment *,
+                                  common::hash::NoPthreadDefendMode> FragmentMap;
+  bool is_inited_;
+  uint64_t tenant_id_;
+  lib::ObMutex lock_;
+  FragmentMap fragment_map_;
+  int64_t mem_used_;
+  int64_t mem_saved_;
+  DISALLOW_COPY_AND_ASSIGN(ObLCSharedFragmentPool);
+};
+
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_SHARED_FRAGMENT_
@@ -186,6 +186,8 @@ int ObPCVSet::inner_get_cache_obj(ObILibCacheCtx &ctx,
       } else if (!need_check_schema && OB_NOT_NULL(pc_ctx.exec_ctx_.get_physical_plan_ctx())) {
         pc_ctx.exec_ctx_.get_physical_plan_ctx()->set_tenant_schema_version(new_tenant_schema_version);
       }
+      // pcv which checks dependent schemas on every get can't be bypassed by session plan hit cache
+      pc_ctx.can_remember_plan_hit_ = pc_ctx.can_remember_plan_hit_ && !need_check_schema;
     }
   }
   if (OB_SUCC(ret)) {
@@ -17,6 +17,7 @@
 #include "lib/json/ob_json_print_utils.h"
 #include "lib/allocator/ob_mod_define.h"
 #include "lib/alloc/alloc_func.h"
+#include "lib/hash_func/murmur_hash.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "lib/allocator/page_arena.h"
 #include "share/config/ob_server_config.h"
@@ -32,6 +33,7 @@
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/plan_cache/ob_plan_cache_callback.h"
 #include "sql/plan_cache/ob_cache_object_factory.h"
+#include "sql/plan_cache/ob_plan_set.h"
 #include "pl/ob_pl.h"
 #include "pl/ob_pl_package.h"
 #include "observer/ob_req_time_service.h"
@@ -415,8 +417,26 @@ int ObPlanCache::check_after_get_plan(int tmp_ret,
     // set context's need_late_compile_ for upper layer to proceed
     pc_ctx.sql_ctx_.need_late_compile_ = need_late_compilation;
   }
+  // an expired hot plan is re-optimized by the first query seeing it, the others keep using
+  // it until the new plan is added, so that they won't all hard parse at the same time
+  bool keep_expired_plan = false;
+  if (OB_SUCC(ret) && plan != NULL && plan->is_expired() && !need_late_compilation
+      && plan->is_hot()) {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    if (plan->try_begin_reoptimize(cur_ts)) {
+      pc_ctx.is_reoptimizing_ = true;
+      ret = OB_SQL_PC_NOT_EXIST;
+      LOG_INFO("expired hot plan will be re-optimized", K(plan->get_plan_id()), K(plan->stat_));
+    } else if (cur_ts - plan->get_reoptimize_start_ts() < ObPhysicalPlan::REOPTIMIZE_TIMEOUT) {
+      keep_expired_plan = true;
+    } else {
+      // the re-optimizing query failed to add a new plan, evict as usual
+    }
+  }
   // if schema expired, update pcv set;
-  if (OB_OLD_SCHEMA_VERSION == ret || (plan != NULL && plan->is_expired()) || need_late_compilation) {
+  if (pc_ctx.is_reoptimizing_ || keep_expired_plan) {
+    // do nothing
+  } else if (OB_OLD_SCHEMA_VERSION == ret || (plan != NULL && plan->is_expired()) || need_late_compilation) {
     if (plan != NULL && plan->is_expired()) {
       LOG_INFO("the statistics of table is stale and evict plan.", K(plan->stat_));
     }
@@ -438,6 +458,7 @@ int ObPlanCache::get_plan(common::ObIAllocator &allocator,
                           ObCacheObjGuard& guard)
 {
   int ret = OB_SUCCESS;
+  bool is_remembered_hit = false;
   
   FLTSpanGuard(pc_get_plan);
   ObGlobalReqTimeService::check_req_timeinfo();
@@ -456,6 +477,11 @@ int ObPlanCache::get_plan(common::ObIAllocator &allocator,
     } else {
       pc_ctx.fp_result_ = pc_ctx.multi_stmt_fp_results_.at(0);
     }
+  } else if (can_use_plan_hit_cache(pc_ctx)
+             && OB_FAIL(get_plan_from_session_hit_cache(pc_ctx, guard, is_remembered_hit))) {
+    LOG_WARN("failed to get plan from session plan hit cache", K(ret));
+  } else if (is_remembered_hit) {
+    // fast parser and plan matching are skipped
   } else if (OB_FAIL(construct_fast_parser_result(allocator,
                                                   pc_ctx,
                                                   pc_ctx.raw_sql_,
@@ -463,7 +489,7 @@ int ObPlanCache::get_plan(common::ObIAllocator &allocator,
     LOG_WARN("failed to construct fast parser results", K(ret));
   }
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(get_plan_cache(pc_ctx, guard))) {
+    if (!is_remembered_hit && OB_FAIL(get_plan_cache(pc_ctx, guard))) {
       SQL_PC_LOG(DEBUG, "failed to get plan", K(ret));
     } else if (OB_ISNULL(guard.cache_obj_)
       || ObLibCacheNameSpace::NS_CRSR != guard.cache_obj_->get_ns()) {
@@ -488,6 +514,9 @@ int ObPlanCache::get_plan(common::ObIAllocator &allocator,
             LOG_WARN("failed to check read_only privilege", K(ret));
           }
         }
+        if (OB_SUCC(ret) && !is_remembered_hit) {
+          remember_plan_hit(pc_ctx, *plan);
+        }
       }
     }
   }
@@ -498,6 +527,280 @@ int ObPlanCache::get_plan(common::ObIAllocator &allocator,
   return ret;
 }
 
+bool ObPlanCache::can_use_plan_hit_cache(ObPlanCacheCtx &pc_ctx)
+{
+  bool bret = false;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  ObJITEnableMode jit_mode = OFF;
+  bool use_plan_baseline = false;
+  bool capture_plan_baseline = false;
+  if (OB_ISNULL(session)) {
+    // do nothing
+  } else if (session->get_tenant_plan_hit_cache_size() <= 0
+             || pc_ctx.is_ps_mode_
+             || pc_ctx.sql_ctx_.multi_stmt_item_.is_batched_multi_stmt()
+             || pc_ctx.sql_ctx_.is_remote_sql_
+             || ObSQLUtils::is_nested_sql(&pc_ctx.exec_ctx_)
+             || ObSQLUtils::is_batch_execute(pc_ctx.sql_ctx_)
+             || session->get_is_in_retry()
+             || session->is_inner()) {
+    // do nothing
+  } else if (OB_SUCCESS != session->get_jit_enabled_mode(jit_mode) || OFF != jit_mode) {
+    // plans of jit may need late compilation, see check_after_get_plan
+  } else if (OB_SUCCESS != session->get_use_plan_baseline(use_plan_baseline)
+             || OB_SUCCESS != session->get_capture_plan_baseline(capture_plan_baseline)
+             || use_plan_baseline
+             || capture_plan_baseline) {
+    // plan evolution needs to go through the plan set
+  } else {
+    bret = true;
+  }
+  return bret;
+}
+
+int ObPlanCache::gen_plan_hit_stamp(ObPlanCacheCtx &pc_ctx, ObPlanHitStamp &stamp)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  uint64_t database_id = OB_INVALID_ID;
+  if (OB_ISNULL(session) || OB_ISNULL(pc_ctx.sql_ctx_.schema_guard_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(session), K(pc_ctx.sql_ctx_.schema_guard_));
+  } else if (OB_FAIL(pc_ctx.sql_ctx_.schema_guard_->get_schema_version(
+                     session->get_effective_tenant_id(), stamp.tenant_schema_version_))) {
+    LOG_WARN("failed to get tenant schema version", K(ret));
+  } else if (OB_FAIL(session->get_database_id(database_id))) {
+    LOG_WARN("failed to get database id", K(ret));
+  } else {
+    const uint64_t tenant_id = session->get_effective_tenant_id();
+    const uint64_t user_id = session->get_user_id();
+    const ObSQLMode sql_mode = session->get_sql_mode();
+    const ObCollationType conn_coll = session->get_local_collation_connection();
+    const uint64_t min_cluster_version = GET_MIN_CLUSTER_VERSION();
+    const ObString &sys_vars_str = session->get_sys_var_in_pc_str();
+    const ObString &config_str = session->get_config_in_pc_str();
+    uint64_t hash_val = 0;
+    hash_val = murmurhash(&tenant_id, sizeof(tenant_id), hash_val);
+    hash_val = murmurhash(&database_id, sizeof(database_id), hash_val);
+    hash_val = murmurhash(&user_id, sizeof(user_id), hash_val);
+    hash_val = murmurhash(&sql_mode, sizeof(sql_mode), hash_val);
+    hash_val = murmurhash(&conn_coll, sizeof(conn_coll), hash_val);
+    hash_val = murmurhash(&min_cluster_version, sizeof(min_cluster_version), hash_val);
+    hash_val = murmurhash(sys_vars_str.ptr(), sys_vars_str.length(), hash_val);
+    hash_val = murmurhash(config_str.ptr(), config_str.length(), hash_val);
+    stamp.session_state_hash_ = hash_val;
+    const ObIArray<uint64_t> &enable_roles = session->get_enable_role_array();
+    hash_val = 0;
+    for (int64_t i = 0; i < enable_roles.count(); ++i) {
+      hash_val = murmurhash(&enable_roles.at(i), sizeof(uint64_t), hash_val);
+    }
+    stamp.enable_role_hash_ = hash_val;
+  }
+  return ret;
+}
+
+// The remembered plan is only reused when it is still local under the current locations,
+// otherwise fall back to the normal path which chooses remote or distributed plan.
+int ObPlanCache::get_plan_from_session_hit_cache(ObPlanCacheCtx &pc_ctx,
+                                                 ObCacheObjGuard &guard,
+                                                 bool &is_hit)
+{
+  int ret = OB_SUCCESS;
+  is_hit = false;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  ObSessionPlanHitCache *hit_cache = NULL;
+  const ObSessionPlanHitCache::Entry *entry = NULL;
+  ObPlanHitStamp stamp;
+  if (OB_ISNULL(session)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret));
+  } else if (OB_ISNULL(hit_cache = session->get_plan_hit_cache())
+             || 0 == hit_cache->count()) {
+    // nothing remembered
+  } else if (OB_FAIL(gen_plan_hit_stamp(pc_ctx, stamp))) {
+    LOG_WARN("failed to gen plan hit stamp", K(ret));
+  } else if (OB_ISNULL(entry = hit_cache->get(pc_ctx.raw_sql_, stamp))) {
+    // not remembered or stale
+  } else {
+    ObCacheObjAtomicOp op(guard.ref_handle_);
+    ObPhysicalPlan *plan = NULL;
+    bool is_local = false;
+    if (OB_FAIL(co_mgr_.atomic_get_cache_obj(entry->plan_id_, op))) {
+      // the plan has been evicted from plan cache
+      LOG_DEBUG("remembered plan is not in plan cache", K(ret), KPC(entry));
+    } else if (FALSE_IT(guard.cache_obj_ = op.get_value())) {
+    } else if (OB_ISNULL(guard.cache_obj_)
+               || ObLibCacheNameSpace::NS_CRSR != guard.cache_obj_->get_ns()) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("cache obj is invalid", K(ret), KPC(entry));
+    } else if (FALSE_IT(plan = static_cast<ObPhysicalPlan *>(guard.cache_obj_))) {
+    } else if (plan->is_expired() || OB_PHY_PLAN_LOCAL != plan->get_plan_type()) {
+      // let the normal path evict or choose the plan
+    } else if (OB_FAIL(fill_plan_hit(pc_ctx, *entry, *plan, is_local))) {
+      LOG_WARN("failed to fill plan hit", K(ret), KPC(entry));
+    } else if (is_local && OB_FAIL(update_remembered_node_stat(pc_ctx, *entry))) {
+      LOG_WARN("failed to update node stat", K(ret), KPC(entry));
+    } else {
+      is_hit = is_local;
+    }
+    if (!is_hit) {
+      ObPhysicalPlanCtx *plan_ctx = pc_ctx.exec_ctx_.get_physical_plan_ctx();
+      if (OB_NOT_NULL(plan_ctx)) {
+        plan_ctx->get_param_store_for_update().reuse();
+      }
+      DAS_CTX(pc_ctx.exec_ctx_).clear_all_location_info();
+      if (OB_NOT_NULL(guard.cache_obj_)) {
+        co_mgr_.free(guard.cache_obj_, guard.ref_handle_);
+        guard.cache_obj_ = NULL;
+      }
+      hit_cache->remove(pc_ctx.raw_sql_);
+      ret = OB_SUCCESS;
+    } else {
+      LOG_DEBUG("get plan from session plan hit cache", KPC(entry), K(stamp));
+    }
+  }
+  return ret;
+}
+
+// The hit and access counts of plan cache and the hit count of the plan are updated by
+// the caller like any other plan cache hit, see ObSql::pc_get_plan and update_plan_stat.
+// Only the lib cache node is bypassed, its stat drives plan cache eviction.
+int ObPlanCache::update_remembered_node_stat(ObPlanCacheCtx &pc_ctx,
+                                             const ObSessionPlanHitCache::Entry &entry)
+{
+  int ret = OB_SUCCESS;
+  ObPlanCacheKey key = entry.pc_key_;
+  ObILibCacheNode *cache_node = NULL;
+  ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+  if (OB_FAIL(get_value(&key, cache_node, r_ref_lock /*read locked*/))) {
+    LOG_DEBUG("failed to get cache node", K(ret), K(key));
+    ret = OB_SUCCESS;
+  } else if (OB_ISNULL(cache_node)) {
+    // the node is evicted after the plan was got
+  } else {
+    if (OB_FAIL(cache_node->update_node_stat(pc_ctx))) {
+      LOG_WARN("failed to update node stat", K(ret));
+    }
+    (void)cache_node->unlock();
+    (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
+  }
+  return ret;
+}
+
+// reproduce what pcv and plan set matching would have done on the physical plan ctx
+int ObPlanCache::fill_plan_hit(ObPlanCacheCtx &pc_ctx,
+                               const ObSessionPlanHitCache::Entry &entry,
+                               ObPhysicalPlan &plan,
+                               bool &is_local)
+{
+  int ret = OB_SUCCESS;
+  is_local = false;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  ObPhysicalPlanCtx *plan_ctx = pc_ctx.exec_ctx_.get_physical_plan_ctx();
+  if (OB_ISNULL(session) || OB_ISNULL(plan_ctx)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(session), K(plan_ctx));
+  } else {
+    ParamStore &param_store = plan_ctx->get_param_store_for_update();
+    param_store.reuse();
+    if (OB_FAIL(param_store.reserve(entry.param_count_))) {
+      LOG_WARN("failed to reserve param store", K(ret), K(entry.param_count_));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < entry.param_count_; ++i) {
+      ObObjParam param = entry.params_[i];
+      if (OB_FAIL(deep_copy_obj(pc_ctx.allocator_, entry.params_[i], param))) {
+        LOG_WARN("failed to deep copy param", K(ret), K(i));
+      } else if (OB_FAIL(param_store.push_back(param))) {
+        LOG_WARN("failed to push back param", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      plan_ctx->set_original_param_cnt(param_store.count());
+      if (OB_FAIL(plan_ctx->init_datum_param_store())) {
+        LOG_WARN("fail to init datum param store", K(ret));
+      } else {
+        if (plan.get_fetch_cur_time()) {
+          plan_ctx->set_cur_time(ObClockGenerator::getClock(), *session);
+        }
+        plan_ctx->set_last_trace_id(session->get_last_trace_id());
+        // the stamp guarantees the tenant schema version is unchanged since the plan was matched
+        plan_ctx->set_tenant_schema_version(entry.stamp_.tenant_schema_version_);
+        session->set_stmt_type(plan.get_stmt_type());
+        if (stmt::T_NONE == pc_ctx.sql_ctx_.stmt_type_) {
+          pc_ctx.sql_ctx_.stmt_type_ = plan.get_stmt_type();
+        }
+        pc_ctx.sql_traits_ = entry.sql_traits_;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ObPhyPlanType plan_type = OB_PHY_PLAN_UNINITIALIZED;
+      bool need_check_on_same_server = true;
+      ObSEArray<ObCandiTableLoc, 2> candi_table_locs;
+      DAS_CTX(pc_ctx.exec_ctx_).clear_all_location_info();
+      if (OB_FAIL(ObPhyLocationGetter::get_phy_locations(plan.get_table_locations(),
+                                                         pc_ctx,
+                                                         candi_table_locs,
+                                                         need_check_on_same_server))) {
+        LOG_WARN("failed to get phy locations", K(ret));
+      } else if (OB_FAIL(ObPhyLocationGetter::build_table_locs(pc_ctx.exec_ctx_.get_das_ctx(),
+                                                               plan.get_table_locations(),
+                                                               candi_table_locs))) {
+        LOG_WARN("fail to init table locs", K(ret));
+      } else if (OB_FAIL(ObSqlPlanSet::calc_phy_plan_type_v2(candi_table_locs,
+                                                             plan_type,
+                                                             need_check_on_same_server))) {
+        LOG_WARN("failed to calcute physical plan type", K(ret));
+      } else {
+        is_local = (OB_PHY_PLAN_LOCAL == plan_type);
+        pc_ctx.exec_ctx_.set_direct_local_plan(false);
+      }
+    }
+  }
+  return ret;
+}
+
+void ObPlanCache::remember_plan_hit(ObPlanCacheCtx &pc_ctx, const ObPhysicalPlan &plan)
+{
+  int tmp_ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = pc_ctx.sql_ctx_.session_info_;
+  ObPhysicalPlanCtx *plan_ctx = pc_ctx.exec_ctx_.get_physical_plan_ctx();
+  ObSessionPlanHitCache *hit_cache = NULL;
+  ObPlanHitStamp stamp;
+  bool can_remember = pc_ctx.can_remember_plan_hit_
+                      && OB_PHY_PLAN_LOCAL == plan.get_plan_type()
+                      && plan.get_pre_calc_frames().is_empty()
+                      && !plan.contain_paramed_column_field()
+                      && !plan.is_limited_concurrent_num()
+                      && !plan.contains_temp_table()
+                      && !plan.is_contain_oracle_session_level_temporary_table()
+                      && OB_NOT_NULL(session)
+                      && OB_NOT_NULL(plan_ctx)
+                      && can_use_plan_hit_cache(pc_ctx);
+  if (can_remember) {
+    const ParamStore &params = plan_ctx->get_param_store();
+    can_remember = params.count() == plan_ctx->get_original_param_cnt();
+    for (int64_t i = 0; can_remember && i < params.count(); ++i) {
+      can_remember = !params.at(i).is_ext();
+    }
+  }
+  if (!can_remember) {
+    // do nothing
+  } else if (OB_ISNULL(hit_cache = session->get_plan_hit_cache(true))) {
+    LOG_WARN("failed to get session plan hit cache");
+  } else if (OB_SUCCESS != (tmp_ret = gen_plan_hit_stamp(pc_ctx, stamp))) {
+    LOG_WARN("failed to gen plan hit stamp", K(tmp_ret));
+  } else if (OB_SUCCESS != (tmp_ret = hit_cache->put(session->get_effective_tenant_id(),
+                                                     session->get_tenant_plan_hit_cache_size(),
+                                                     pc_ctx.raw_sql_,
+                                                     stamp,
+                                                     plan.get_plan_id(),
+                                                     pc_ctx.fp_result_.pc_key_,
+                                                     pc_ctx.sql_traits_,
+                                                     plan_ctx->get_param_store()))) {
+    LOG_WARN("failed to remember plan hit", K(tmp_ret), K(plan.get_plan_id()));
+  }
+}
+
 int ObPlanCache::construct_multi_stmt_fast_parser_result(common::ObIAllocator &allocator,
                                                          ObPlanCacheCtx &pc_ctx)
 {
@@ -767,16 +1070,27 @@ int ObPlanCache::add_plan_cache(ObILibCacheCtx &ctx,
   } else {
     ObPlanCacheCtx &pc_ctx = static_cast<ObPlanCacheCtx&>(ctx);
     pc_ctx.key_ = &(pc_ctx.fp_result_.pc_key_);
-    do {
-      if (OB_FAIL(add_cache_obj(ctx, pc_ctx.key_, cache_obj)) && OB_OLD_SCHEMA_VERSION == ret) {
-        SQL_PC_LOG(INFO, "table or view in plan cache value is old", K(ret));
-        int tmp_ret = OB_SUCCESS;
-        if (OB_SUCCESS != (tmp_ret = remove_cache_node(pc_ctx.key_))) {
-          ret = tmp_ret;
-          SQL_PC_LOG(WARN, "fail to remove lib cache node", K(ret));
-        }
+    if (pc_ctx.is_reoptimizing_) {
+      // replace the cache node holding the expired plan with the re-optimized one
+      pc_ctx.is_reoptimizing_ = false;
+      if (OB_FAIL(remove_cache_node(pc_ctx.key_))) {
+        SQL_PC_LOG(WARN, "fail to remove cache node of expired plan", K(ret));
       }
-    } while (OB_OLD_SCHEMA_VERSION == ret);
+    }
+    if (OB_FAIL(ret)) {
+      // do nothing
+    } else {
+      do {
+        if (OB_FAIL(add_cache_obj(ctx, pc_ctx.key_, cache_obj)) && OB_OLD_SCHEMA_VERSION == ret) {
+          SQL_PC_LOG(INFO, "table or view in plan cache value is old", K(ret));
+          int tmp_ret = OB_SUCCESS;
+          if (OB_SUCCESS != (tmp_ret = remove_cache_node(pc_ctx.key_))) {
+            ret = tmp_ret;
+            SQL_PC_LOG(WARN, "fail to remove lib cache node", K(ret));
+          }
+        }
+      } while (OB_OLD_SCHEMA_VERSION == ret);
+    }
   }
   return ret;
 }
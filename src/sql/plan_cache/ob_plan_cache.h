@@ -24,6 +24,7 @@
 #include "sql/plan_cache/ob_lib_cache_key_creator.h"
 #include "sql/plan_cache/ob_lib_cache_node_factory.h"
 #include "sql/plan_cache/ob_lib_cache_object_manager.h"
+#include "sql/plan_cache/ob_session_plan_hit_cache.h"
 
 namespace oceanbase
 {
@@ -247,7 +248,12 @@ public:
   {
     lib::ObLabel label;
     label = ObNewModIds::OB_SQL_PLAN_CACHE;
-    return mem_used_ + get_label_hold(label);
+    return mem_used_ + get_label_hold(label) + co_mgr_.get_fragment_pool().get_mem_used();
+  }
+  // memory saved by sharing immutable fragments between cache objects
+  int64_t get_shared_fragment_mem_saved() const
+  {
+    return co_mgr_.get_fragment_pool().get_mem_saved();
   }
   int64_t get_mem_hold() const;
   int64_t get_label_hold(lib::ObLabel &label) const;
@@ -364,6 +370,19 @@ private:
                               const ObILibCacheObject &cache_object);
   int get_pl_cache(ObPlanCacheCtx &pc_ctx, ObCacheObjGuard& guard);
   int check_after_get_plan(int tmp_ret, ObILibCacheCtx &ctx, ObILibCacheObject *cache_obj);
+  // session plan hit cache, repeated identical text bypasses fast parser and plan matching
+  bool can_use_plan_hit_cache(ObPlanCacheCtx &pc_ctx);
+  int gen_plan_hit_stamp(ObPlanCacheCtx &pc_ctx, ObPlanHitStamp &stamp);
+  int get_plan_from_session_hit_cache(ObPlanCacheCtx &pc_ctx,
+                                      ObCacheObjGuard &guard,
+                                      bool &is_hit);
+  int update_remembered_node_stat(ObPlanCacheCtx &pc_ctx,
+                                  const ObSessionPlanHitCache::Entry &entry);
+  int fill_plan_hit(ObPlanCacheCtx &pc_ctx,
+                    const ObSessionPlanHitCache::Entry &entry,
+                    ObPhysicalPlan &plan,
+                    bool &is_local);
+  void remember_plan_hit(ObPlanCacheCtx &pc_ctx, const ObPhysicalPlan &plan);
 private:
   const static int64_t SLICE_SIZE = 1024; //1k
 private:
@@ -293,7 +293,9 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
       fixed_param_idx_(allocator),
       need_add_obj_stat_(true),
       is_inner_sql_(false),
-      ab_params_(NULL)
+      ab_params_(NULL),
+      can_remember_plan_hit_(false),
+      is_reoptimizing_(false)
   {
     fp_result_.pc_key_.is_ps_mode_ = is_ps_mode_;
   }
@@ -351,7 +353,9 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
     K(ps_need_parameterized_),
     K(fixed_param_idx_),
     K(need_add_obj_stat_),
-    K(is_inner_sql_)
+    K(is_inner_sql_),
+    K(can_remember_plan_hit_),
+    K(is_reoptimizing_)
     );
   bool is_ps_mode_; //control use which variables to do match
 
@@ -399,6 +403,11 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
   bool need_add_obj_stat_;
   bool is_inner_sql_;
   ParamStore *ab_params_;  // arraybinding batch parameters,
+  // set when the plan got from plan set can be remembered by ObSessionPlanHitCache
+  bool can_remember_plan_hit_;
+  // this query re-optimizes an expired hot plan, which keeps serving other queries
+  // until the new plan replaces its cache node, see ObPlanCache::check_after_get_plan
+  bool is_reoptimizing_;
 };
 
 struct ObPlanCacheStat
@@ -470,6 +470,10 @@ int ObPlanCacheValue::choose_plan(ObPlanCacheCtx &pc_ctx,
               SQL_PC_LOG(TRACE, "failed to select plan in plan set", K(ret));
             }
           } else {
+            pc_ctx.can_remember_plan_hit_ = need_param_
+                                            && !is_nested_sql_
+                                            && !is_batch_execute_
+                                            && plan_set->can_remember_plan_hit();
             break; //这个地方建议保留，如果去掉，需要另外加标记在for()中判断，并且不使用上面的for循环的宏；
           }
         }
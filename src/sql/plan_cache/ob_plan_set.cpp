@@ -2121,5 +2121,16 @@ bool ObSqlPlanSet::is_sql_planset()
   return true;
 }
 
+bool ObSqlPlanSet::can_remember_plan_hit() const
+{
+  return 0 == need_try_plan_
+      && !is_multi_stmt_plan()
+      && !has_duplicate_table_
+      && !is_contain_virtual_table_
+      && !enable_inner_part_parallel_exec_
+      && 0 == related_user_var_names_.count()
+      && all_pre_calc_constraints_.is_empty();
+}
+
 }
 }
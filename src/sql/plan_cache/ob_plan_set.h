@@ -155,6 +155,9 @@ public:
                            int64_t outline_param_idx,
                            common::ObIAllocator* pc_alloc_);
   virtual bool is_sql_planset() = 0;
+  // whether the plan selected from this set only depends on the param values and the
+  // table locations, so a hit can be remembered by ObSessionPlanHitCache
+  virtual bool can_remember_plan_hit() const { return false; }
 /*  static int check_array_bind_same_bool_param(*/
                //const Ob2DArray<ObParamInfo,
                                  //OB_MALLOC_BIG_BLOCK_SIZE,
@@ -257,6 +260,7 @@ public:
   virtual int64_t get_mem_size() override;
   virtual void reset() override;
   virtual bool is_sql_planset() override;
+  virtual bool can_remember_plan_hit() const override;
   virtual int init_new_set(const ObPlanCacheCtx &pc_ctx,
                            const ObPlanCacheObject &cache_obj,
                            int64_t outline_param_idx,
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include "sql/plan_cache/ob_session_plan_hit_cache.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/hash_func/murmur_hash.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+void ObSessionPlanHitCache::reset()
+{
+  for (int64_t i = 0; i < entry_cnt_; ++i) {
+    if (OB_NOT_NULL(entries_[i])) {
+      entries_[i]->~Entry();
+      ob_free(entries_[i]);
+      entries_[i] = NULL;
+    }
+  }
+  entry_cnt_ = 0;
+  access_seq_ = 0;
+}
+
+int64_t ObSessionPlanHitCache::find(const ObString &raw_sql, const uint64_t sql_hash) const
+{
+  int64_t idx = -1;
+  for (int64_t i = 0; idx < 0 && i < entry_cnt_; ++i) {
+    if (sql_hash == entries_[i]->sql_hash_ && raw_sql == entries_[i]->raw_sql_) {
+      idx = i;
+    }
+  }
+  return idx;
+}
+
+void ObSessionPlanHitCache::copy_string(const ObString &src, char *buf, int64_t &pos, ObString &dst)
+{
+  MEMCPY(buf + pos, src.ptr(), src.length());
+  dst.assign_ptr(buf + pos, src.length());
+  pos += src.length();
+}
+
+void ObSessionPlanHitCache::free_entry(const int64_t idx)
+{
+  if (idx >= 0 && idx < entry_cnt_) {
+    entries_[idx]->~Entry();
+    ob_free(entries_[idx]);
+    entries_[idx] = entries_[entry_cnt_ - 1];
+    entries_[entry_cnt_ - 1] = NULL;
+    --entry_cnt_;
+  }
+}
+
+const ObSessionPlanHitCache::Entry *ObSessionPlanHitCache::get(const ObString &raw_sql,
+                                                              const ObPlanHitStamp &stamp)
+{
+  Entry *entry = NULL;
+  if (entry_cnt_ > 0) {
+    const uint64_t sql_hash = murmurhash(raw_sql.ptr(), raw_sql.length(), 0);
+    const int64_t idx = find(raw_sql, sql_hash);
+    if (idx < 0) {
+      // not remembered
+    } else if (!(entries_[idx]->stamp_ == stamp)) {
+      LOG_DEBUG("session plan hit entry is stale", KPC(entries_[idx]), K(stamp));
+      free_entry(idx);
+    } else {
+      entry = entries_[idx];
+      entry->last_access_seq_ = ++access_seq_;
+    }
+  }
+  return entry;
+}
+
+int ObSessionPlanHitCache::put(const uint64_t tenant_id,
+                               const int64_t capacity,
+                               const ObString &raw_sql,
+                               const ObPlanHitStamp &stamp,
+                               const ObCacheObjID plan_id,
+                               const ObPlanCacheKey &pc_key,
+                               const ObSqlTraits &sql_traits,
+                               const ParamStore &params)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t sql_hash = murmurhash(raw_sql.ptr(), raw_sql.length(), 0);
+  int64_t mem_size = sizeof(Entry) + raw_sql.length() + sizeof(ObObjParam) * params.count()
+                     + pc_key.name_.length() + pc_key.sys_vars_str_.length()
+                     + pc_key.config_str_.length();
+  for (int64_t i = 0; i < params.count(); ++i) {
+    mem_size += params.at(i).get_deep_copy_size();
+  }
+  const int64_t limit = MIN(capacity, MAX_ENTRY_COUNT);
+  if (limit <= 0 || mem_size > MAX_ENTRY_MEM_SIZE) {
+    // do nothing
+  } else {
+    if (tenant_id != tenant_id_) {
+      reset();
+      tenant_id_ = tenant_id;
+    }
+    const int64_t old_idx = find(raw_sql, sql_hash);
+    if (old_idx >= 0) {
+      free_entry(old_idx);
+    }
+    while (entry_cnt_ >= limit) {
+      int64_t lru_idx = 0;
+      for (int64_t i = 1; i < entry_cnt_; ++i) {
+        if (entries_[i]->last_access_seq_ < entries_[lru_idx]->last_access_seq_) {
+          lru_idx = i;
+        }
+      }
+      free_entry(lru_idx);
+    }
+    char *buf = NULL;
+    Entry *entry = NULL;
+    if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(mem_size,
+                                                      ObMemAttr(tenant_id, "SessPlanHit"))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocate session plan hit entry", K(ret), K(mem_size));
+    } else {
+      int64_t pos = sizeof(Entry);
+      entry = new (buf) Entry();
+      entry->sql_hash_ = sql_hash;
+      entry->stamp_ = stamp;
+      entry->plan_id_ = plan_id;
+      entry->sql_traits_ = sql_traits;
+      entry->mem_size_ = mem_size;
+      entry->params_ = reinterpret_cast<ObObjParam *>(buf + pos);
+      pos += sizeof(ObObjParam) * params.count();
+      for (int64_t i = 0; OB_SUCC(ret) && i < params.count(); ++i) {
+        ObObjParam *param = new (entry->params_ + i) ObObjParam(params.at(i));
+        entry->param_count_ = i + 1;
+        if (OB_FAIL(param->deep_copy(params.at(i), buf, mem_size, pos))) {
+          LOG_WARN("failed to deep copy param", K(ret), K(i), K(params.at(i)));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        copy_string(raw_sql, buf, pos, entry->raw_sql_);
+        entry->pc_key_.key_id_ = pc_key.key_id_;
+        entry->pc_key_.db_id_ = pc_key.db_id_;
+        entry->pc_key_.sessid_ = pc_key.sessid_;
+        entry->pc_key_.is_ps_mode_ = pc_key.is_ps_mode_;
+        entry->pc_key_.namespace_ = pc_key.namespace_;
+        copy_string(pc_key.name_, buf, pos, entry->pc_key_.name_);
+        copy_string(pc_key.sys_vars_str_, buf, pos, entry->pc_key_.sys_vars_str_);
+        copy_string(pc_key.config_str_, buf, pos, entry->pc_key_.config_str_);
+        entry->last_access_seq_ = ++access_seq_;
+        entries_[entry_cnt_++] = entry;
+      } else {
+        entry->~Entry();
+        ob_free(buf);
+      }
+    }
+  }
+  return ret;
+}
+
+void ObSessionPlanHitCache::remove(const ObString &raw_sql)
+{
+  if (entry_cnt_ > 0) {
+    free_entry(find(raw_sql, murmurhash(raw_sql.ptr(), raw_sql.length(), 0)));
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_SESSION_PLAN_HIT_CACHE_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_SESSION_PLAN_HIT_CACHE_
+
+#include "lib/string/ob_string.h"
+#include "common/object/ob_object.h"
+#include "sql/ob_sql_define.h"
+#include "sql/ob_sql_utils.h"
+#include "sql/plan_cache/ob_plan_cache_util.h"
+#include "sql/plan_cache/ob_plan_cache_struct.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// the session state under which a remembered plan hit is still valid
+struct ObPlanHitStamp
+{
+  ObPlanHitStamp()
+    : tenant_schema_version_(common::OB_INVALID_VERSION), session_state_hash_(0),
+      enable_role_hash_(0)
+  {}
+  bool operator==(const ObPlanHitStamp &other) const
+  {
+    return tenant_schema_version_ == other.tenant_schema_version_
+        && session_state_hash_ == other.session_state_hash_
+        && enable_role_hash_ == other.enable_role_hash_;
+  }
+  // any ddl, privilege or outline change in tenant pushes up the tenant schema version
+  int64_t tenant_schema_version_;
+  // hash of database, user, sql mode, connection collation, sys vars and configs in pc key
+  uint64_t session_state_hash_;
+  // hash of the roles enabled by SET ROLE, which changes the privileges without ddl
+  uint64_t enable_role_hash_;
+  TO_STRING_KV(K_(tenant_schema_version), K_(session_state_hash), K_(enable_role_hash));
+};
+
+/**
+ * @brief small per-session LRU, remembers the plan a raw sql text hit in plan cache last time
+ *        with the params resolved from the text.
+ *        Identical text under the same stamp resolves to the same params, so the next
+ *        execution could skip fast parser, pcv matching and plan set matching,
+ *        see ObPlanCache::get_plan_from_session_hit_cache.
+ *        Only used by the session's own worker, no concurrency control.
+ */
+class ObSessionPlanHitCache
+{
+public:
+  static const int64_t MAX_ENTRY_COUNT = 64;
+  static const int64_t MAX_ENTRY_MEM_SIZE = 16 * 1024;  // big queries are not remembered
+  struct Entry
+  {
+    Entry()
+      : sql_hash_(0), raw_sql_(), stamp_(), plan_id_(common::OB_INVALID_ID), pc_key_(),
+        sql_traits_(), params_(NULL), param_count_(0), mem_size_(0), last_access_seq_(0)
+    {}
+    TO_STRING_KV(K_(sql_hash), K_(raw_sql), K_(stamp), K_(plan_id), K_(pc_key), K_(param_count),
+                 K_(mem_size), K_(last_access_seq));
+    uint64_t sql_hash_;
+    common::ObString raw_sql_;
+    ObPlanHitStamp stamp_;
+    ObCacheObjID plan_id_;
+    ObPlanCacheKey pc_key_; // key of the lib cache node holding the plan
+
+    ObSqlTraits sql_traits_;
+    common::ObObjParam *params_;
+    int64_t param_count_;
+    int64_t mem_size_;
+    uint64_t last_access_seq_;
+  };
+public:
+  ObSessionPlanHitCache() : entry_cnt_(0), access_seq_(0), tenant_id_(common::OB_INVALID_TENANT_ID)
+  {
+    MEMSET(entries_, 0, sizeof(entries_));
+  }
+  ~ObSessionPlanHitCache() { reset(); }
+  void reset();
+  // returns NULL if the text is not remembered, stale entry under a different stamp is removed
+  const Entry *get(const common::ObString &raw_sql, const ObPlanHitStamp &stamp);
+  // remember a hit, the least recently used entry is replaced when capacity is reached
+  int put(const uint64_t tenant_id,
+          const int64_t capacity,
+          const common::ObString &raw_sql,
+          const ObPlanHitStamp &stamp,
+          const ObCacheObjID plan_id,
+          const ObPlanCacheKey &pc_key,
+          const ObSqlTraits &sql_traits,
+          const ParamStore &params);
+  void remove(const common::ObString &raw_sql);
+  int64_t count() const { return entry_cnt_; }
+  TO_STRING_KV(K_(entry_cnt), K_(access_seq), K_(tenant_id));
+private:
+  int64_t find(const common::ObString &raw_sql, const uint64_t sql_hash) const;
+  static void copy_string(const common::ObString &src, char *buf, int64_t &pos, common::ObString &dst);
+  void free_entry(const int64_t idx);
+private:
+  Entry *entries_[MAX_ENTRY_COUNT];
+  int64_t entry_cnt_;
+  uint64_t access_seq_;
+  uint64_t tenant_id_;
+  DISALLOW_COPY_AND_ASSIGN(ObSessionPlanHitCache);
+};
+
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_SESSION_PLAN_HIT_CACHE_
@@ -18,6 +18,7 @@
 #include "lib/string/ob_sql_string.h"
 #include "lib/rc/ob_rc.h"
 #include "sql/plan_cache/ob_plan_cache_manager.h"
+#include "sql/plan_cache/ob_session_plan_hit_cache.h"
 #include "sql/ob_sql_utils.h"
 #include "sql/ob_sql_trans_control.h"
 #include "sql/session/ob_sql_session_mgr.h"
@@ -165,6 +166,7 @@ ObSQLSessionInfo::ObSQLSessionInfo() :
       ddl_info_(),
       is_table_name_hidden_(false),
       piece_cache_(NULL),
+      plan_hit_cache_(NULL),
       is_load_data_exec_session_(false),
       is_registered_to_deadlock_(false),
       pl_exact_err_msg_(),
@@ -247,6 +249,9 @@ void ObSQLSessionInfo::reset(bool skip_sys_var)
   if (is_inited_) {
     // ObVersionProvider::reset();
     reset_all_package_changed_info();
+    if (NULL != plan_hit_cache_) {
+      plan_hit_cache_->reset();
+    }
     warnings_buf_.reset();
     show_warnings_buf_.reset();
     end_trans_cb_.reset(),
@@ -421,6 +426,12 @@ void ObSQLSessionInfo::destroy(bool skip_sys_var)
       piece_cache_ = NULL;
     }
 
+    if (NULL != plan_hit_cache_) {
+      plan_hit_cache_->~ObSessionPlanHitCache();
+      get_session_allocator().free(plan_hit_cache_);
+      plan_hit_cache_ = NULL;
+    }
+
 
     if (OB_SUCC(ret) && OB_FAIL(free_dblink_conn_pool())) {
       LOG_WARN("fail to free dblink conn pool", K(ret));
@@ -2330,6 +2341,8 @@ void ObSQLSessionInfo::ObCachedTenantConfigInfo::refresh()
       }
       // 6. enable extended SQL syntax in the MySQL mode
       enable_sql_extension_ = tenant_config->enable_sql_extension;
+      // 7. session plan hit cache size
+      ATOMIC_STORE(&plan_hit_cache_size_, tenant_config->_session_plan_hit_cache_size);
     }
     //timezone的更新频率非常低，放到后台驱动
     (void)session_->update_timezone_info();
@@ -2381,6 +2394,19 @@ void* ObSQLSessionInfo::get_piece_cache(bool need_init) {
   return piece_cache_;
 }
 
+ObSessionPlanHitCache *ObSQLSessionInfo::get_plan_hit_cache(bool need_init)
+{
+  if (NULL == plan_hit_cache_ && need_init) {
+    void *buf = get_session_allocator().alloc(sizeof(ObSessionPlanHitCache));
+    if (NULL != buf) {
+      plan_hit_cache_ = new (buf) ObSessionPlanHitCache();
+    } else {
+      LOG_WARN("failed to allocate session plan hit cache");
+    }
+  }
+  return plan_hit_cache_;
+}
+
 
 
 
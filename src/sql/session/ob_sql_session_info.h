@@ -78,6 +78,7 @@ class ObPsSessionInfo;
 class ObPsStmtInfo;
 class ObStmt;
 class ObSQLSessionInfo;
+class ObSessionPlanHitCache;
 
 class SessionInfoKey
 {
@@ -466,6 +467,7 @@ public:
                                  enable_bloom_filter_(true),
                                  at_type_(ObAuditTrailType::NONE),
                                  sort_area_size_(128*1024*1024),
+                                 plan_hit_cache_size_(0),
                                  last_check_ec_ts_(0),
                                  session_(session)
     {
@@ -478,6 +480,7 @@ public:
     bool get_enable_sql_extension() const { return enable_sql_extension_; }
     ObAuditTrailType get_at_type() const { return at_type_; }
     int64_t get_sort_area_size() const { return ATOMIC_LOAD(&sort_area_size_); }
+    int64_t get_plan_hit_cache_size() const { return ATOMIC_LOAD(&plan_hit_cache_size_); }
   private:
     //租户级别配置项缓存session 上，避免每次获取都需要刷新
     bool is_external_consistent_;
@@ -487,6 +490,7 @@ public:
     bool enable_bloom_filter_;
     ObAuditTrailType at_type_;
     int64_t sort_area_size_;
+    int64_t plan_hit_cache_size_;
     int64_t last_check_ec_ts_;
     ObSQLSessionInfo *session_;
   };
@@ -916,6 +920,11 @@ public:
     cached_tenant_config_info_.refresh();
     return cached_tenant_config_info_.get_sort_area_size();
   }
+  int64_t get_tenant_plan_hit_cache_size()
+  {
+    cached_tenant_config_info_.refresh();
+    return cached_tenant_config_info_.get_plan_hit_cache_size();
+  }
   int get_tmp_table_size(uint64_t &size);
   int ps_use_stream_result_set(bool &use_stream);
   void set_proxy_version(uint64_t v) { proxy_version_ = v; }
@@ -926,6 +935,8 @@ public:
 
   // piece
   void *get_piece_cache(bool need_init = false);
+  // remembers the plans hit by raw sql text, see ObSessionPlanHitCache
+  ObSessionPlanHitCache *get_plan_hit_cache(bool need_init = false);
 
   void set_load_data_exec_session(bool v) { is_load_data_exec_session_ = v; }
   bool is_load_data_exec_session() const { return is_load_data_exec_session_; }
@@ -1075,6 +1086,7 @@ private:
   ObSessionDDLInfo ddl_info_;
   bool is_table_name_hidden_;
   void *piece_cache_;
+  ObSessionPlanHitCache *plan_hit_cache_;
   bool is_load_data_exec_session_;
   // 记录session是否注册过死锁检测的信息
   bool is_registered_to_deadlock_;
@@ -538,7 +538,7 @@ int ObIndexTreeMultiPassPrefetcher::init_basic_info(
     case ObStoreRowIterator::IteratorMultiGet: {
       rowkeys_ = static_cast<const common::ObIArray<blocksstable::ObDatumRowkey> *> (query_range);
       range_count = rowkeys_->count();
-      max_range_prefetching_cnt_ = min(range_count, DEFAULT_SCAN_RANGE_PREFETCH_CNT);
+      max_range_prefetching_cnt_ = min(range_count, MULTI_RANGE_PREFETCH_CNT);
       if (0 == range_count) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("range count should be greater than 0", K(ret), K(range_count));
@@ -556,7 +556,8 @@ int ObIndexTreeMultiPassPrefetcher::init_basic_info(
     case ObStoreRowIterator::IteratorMultiScan: {
       ranges_ = static_cast<const common::ObIArray<blocksstable::ObDatumRange> *>(query_range);
       range_count = ranges_->count();
-      max_range_prefetching_cnt_ = DEFAULT_SCAN_RANGE_PREFETCH_CNT;
+      max_range_prefetching_cnt_ = max(DEFAULT_SCAN_RANGE_PREFETCH_CNT,
+                                       min(range_count, MULTI_RANGE_PREFETCH_CNT));
       if (0 == range_count) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("range count should be greater than 0", K(ret), K(range_count));
@@ -586,6 +587,9 @@ int ObIndexTreeMultiPassPrefetcher::init_basic_info(
  * Prefetch index tree at each level before prefetch micro data block,
  * so that index block could be load when read the rows of data_block.
  * If the last row read is non-data-block, stop the prefetching. Others, micro data blocks prefetched.
+ * For multi get and multi scan, the next ranges are added in the same round as long as the previous
+ * one is located, so the micro blocks of rowkeys and short ranges are read in parallel rather than
+ * one by one.
  */
 int ObIndexTreeMultiPassPrefetcher::prefetch()
 {
@@ -596,20 +600,26 @@ int ObIndexTreeMultiPassPrefetcher::prefetch()
   } else if (is_prefetch_end_) {
   } else if (micro_data_prefetch_idx_ - cur_micro_data_fetch_idx_ >= max_micro_handle_cnt_ / 2) {
     // continue current prefetch
-  } else if (OB_FAIL(prefetch_index_tree())) {
-    if (OB_LIKELY(OB_ITER_END == ret)) {
-      is_prefetch_end_ = true;
-      ret = OB_SUCCESS;
-    } else {
-      LOG_WARN("Fail to prefetch index tree", K(ret));
-    }
-  } else if (OB_FAIL(prefetch_micro_data())) {
-    if (OB_LIKELY(OB_ITER_END == ret)) {
-      is_prefetch_end_ = true;
-      ret = OB_SUCCESS;
-    } else {
-      LOG_WARN("Fail to prefetch", K(ret));
-    } 
+  } else {
+    int32_t prev_range_prefetch_idx = 0;
+    do {
+      prev_range_prefetch_idx = cur_range_prefetch_idx_;
+      if (OB_FAIL(prefetch_index_tree())) {
+        if (OB_LIKELY(OB_ITER_END == ret)) {
+          is_prefetch_end_ = true;
+          ret = OB_SUCCESS;
+        } else {
+          LOG_WARN("Fail to prefetch index tree", K(ret));
+        }
+      } else if (OB_FAIL(prefetch_micro_data())) {
+        if (OB_LIKELY(OB_ITER_END == ret)) {
+          is_prefetch_end_ = true;
+          ret = OB_SUCCESS;
+        } else {
+          LOG_WARN("Fail to prefetch", K(ret));
+        }
+      }
+    } while (OB_SUCC(ret) && can_prefetch_more_range(prev_range_prefetch_idx));
   }
   return ret;
 }
@@ -274,6 +274,15 @@ private:
   struct ObIndexTreeLevelHandle;
   int prefetch_index_tree();
   int prefetch_micro_data();
+  OB_INLINE bool can_prefetch_more_range(const int32_t prev_range_prefetch_idx) const
+  {
+    return (ObStoreRowIterator::IteratorMultiGet == iter_type_ ||
+            ObStoreRowIterator::IteratorMultiScan == iter_type_) &&
+        !is_prefetch_end_ &&
+        prev_range_prefetch_idx < cur_range_prefetch_idx_ &&
+        cur_range_prefetch_idx_ - cur_range_fetch_idx_ < max_range_prefetching_cnt_ &&
+        micro_data_prefetch_idx_ - cur_micro_data_fetch_idx_ < max_micro_handle_cnt_ / 2;
+  }
   int try_add_query_range(ObIndexTreeLevelHandle &tree_handle);
   int drill_down();
   int prepare_read_handle(
@@ -295,6 +304,9 @@ private:
 
   static const int32_t DEFAULT_SCAN_RANGE_PREFETCH_CNT = 4;
   static const int32_t DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT = 32;
+  // rowkeys of index lookup and ranges of batch(group) scan are usually short, keep more of them
+  // in flight so that their micro blocks are read in parallel
+  static const int32_t MULTI_RANGE_PREFETCH_CNT = DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT / 2;
   static const int32_t INDEX_TREE_PREFETCH_DEPTH = 3;
   struct ObIndexBlockReadHandle {
     ObIndexBlockReadHandle() :
@@ -473,6 +473,7 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
     common::ObBitmap &bitmap)
 {
   int ret = OB_SUCCESS;
+  bool is_bypass = false;
   if (!reverse_scan_) {
     pd_filter_info.start_ = current_;
     pd_filter_info.end_ = last_ + 1;
@@ -484,6 +485,13 @@ int ObIMicroBlockRowScanner::filter_pushdown_filter(
                   nullptr == filter || !filter->is_filter_node())) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument", K(ret), KP(reader_), KP_(block_row_store), KPC(filter));
+  } else if (filter->is_filter_black_node()
+             && OB_FAIL(static_cast<sql::ObBlackFilterExecutor *>(filter)->check_filter_bypass(
+                        pd_filter_info.end_ - pd_filter_info.start_, is_bypass))) {
+    LOG_WARN("Failed to check black filter bypass", K(ret));
+  } else if (is_bypass) {
+    // runtime join filter is not ready, all rows pass without decoding the filter columns
+    bitmap.reuse(true);
   } else if (ObIMicroBlockReader::Decoder == reader_->get_type()) {
     blocksstable::ObMicroBlockDecoder *decoder = static_cast<blocksstable::ObMicroBlockDecoder *>(reader_);
     if (filter->is_filter_black_node()) {
@@ -18,6 +18,7 @@
 #include "lib/utility/utility.h"
 #include "share/ob_define.h"
 #include "share/inner_table/ob_inner_table_schema_constants.h"
+#include "share/config/ob_server_config.h"
 #include "ob_trans_define.h"
 
 namespace oceanbase
@@ -49,6 +50,25 @@ inline bool atomic_update(int64_t *v, const int64_t x)
   return bool_ret;
 }
 
+// With gts lease enabled, every gts is generated no less than the clock of the generating
+// server plus the clock uncertainty, and a version is regarded as elapsed only after the local
+// clock exceeds it by the clock uncertainty. So a gts generated locally under the lease is
+// never less than the version of any transaction which has returned commit to its client.
+inline bool is_gts_lease_enabled()
+{
+  return GCONF._gts_lease_time > 0;
+}
+
+inline int64_t get_gts_lease_time_us()
+{
+  return GCONF._gts_lease_time;
+}
+
+inline int64_t get_gts_clock_uncertainty_ns()
+{
+  return is_gts_lease_enabled() ? GCONF._gts_clock_uncertainty * 1000 : 0;
+}
+
 } // transaction
 } // oceanbase
 
@@ -28,6 +28,8 @@ void ObGTSLocalCache::reset()
   barrier_ts_ = 0;
   latest_srr_.reset();
   receive_gts_ts_.reset();
+  lease_expire_ts_.reset();
+  lease_gts_end_ = 0;
 }
 
 //Due to network and other factors, it is impossible to guarantee that srr and gts maintain partial order,
@@ -178,5 +180,54 @@ int ObGTSLocalCache::update_base_ts(const int64_t base_ts)
   return ret;
 }
 
+// The lease is counted from the time the request was sent, which is no later than
+// the time the gts leader granted it
+int ObGTSLocalCache::update_lease(const MonotonicTs srr, const int64_t lease_gts_end)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(!srr.is_valid()) || OB_UNLIKELY(lease_gts_end <= 0)
+      || lease_gts_end >= INT64_MAX/2) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", KR(ret), K(srr), K(lease_gts_end));
+  } else {
+    // The update sequence must be lease_gts_end first, then lease_expire_ts
+    (void)atomic_update(&lease_gts_end_, lease_gts_end);
+    (void)atomic_update(&lease_expire_ts_.mts_, srr.mts_ + get_gts_lease_time_us());
+  }
+
+  return ret;
+}
+
+int ObGTSLocalCache::get_gts_by_lease(const MonotonicTs now,
+                                      int64_t &gts,
+                                      MonotonicTs &receive_gts_ts)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(!now.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", KR(ret), K(now));
+  } else if (!is_gts_lease_enabled() || now.mts_ >= ATOMIC_LOAD(&lease_expire_ts_.mts_)) {
+    ret = OB_EAGAIN;
+  } else {
+    const int64_t lease_gts = max(ObTimeUtility::current_time_ns() + get_gts_clock_uncertainty_ns(),
+                                  ATOMIC_LOAD(&gts_));
+    bool is_cross_barrier = false;
+    if (lease_gts >= ATOMIC_LOAD(&lease_gts_end_)) {
+      ret = OB_EAGAIN;
+    } else if (OB_FAIL(update_gts_and_check_barrier(now, lease_gts, now, is_cross_barrier))) {
+      TRANS_LOG(WARN, "update gts by lease failed", KR(ret), K(now), K(lease_gts));
+    } else if (!is_cross_barrier) {
+      ret = OB_EAGAIN;
+    } else {
+      gts = lease_gts;
+      receive_gts_ts = now;
+    }
+  }
+
+  return ret;
+}
+
 } // transaction
 } // oceanbase
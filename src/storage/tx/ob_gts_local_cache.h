@@ -47,8 +47,11 @@ public:
   int get_srr_and_gts_safe(MonotonicTs &srr, int64_t &gts, MonotonicTs &receive_gts_ts) const;
   int update_latest_srr(const MonotonicTs latest_srr);
   int update_base_ts(const int64_t base_ts);
+  int update_lease(const MonotonicTs srr, const int64_t lease_gts_end);
+  int get_gts_by_lease(const MonotonicTs now, int64_t &gts, MonotonicTs &receive_gts_ts);
 
-  TO_STRING_KV(K_(srr), K_(gts), K_(barrier_ts), K_(latest_srr));
+  TO_STRING_KV(K_(srr), K_(gts), K_(barrier_ts), K_(latest_srr), K_(lease_expire_ts),
+               K_(lease_gts_end));
 private:
   // send rpc request timestamp
   MonotonicTs srr_;
@@ -59,6 +62,9 @@ private:
   MonotonicTs latest_srr_;
   // receive gts
   MonotonicTs receive_gts_ts_;
+  // gts can be generated locally before lease_expire_ts_, but never reach lease_gts_end_
+  MonotonicTs lease_expire_ts_;
+  int64_t lease_gts_end_;
 };
 
 } // transaction
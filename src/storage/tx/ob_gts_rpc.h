@@ -217,6 +217,7 @@ private:
         } else if (OB_FAIL(ts_mgr_->update_gts(result.get_tenant_id(),
                                                result.get_srr(),
                                                result.get_gts_start(),
+                                               result.get_gts_end(),
                                                transaction::TS_SOURCE_GTS,
                                                update))) {
         } else if (!update) {
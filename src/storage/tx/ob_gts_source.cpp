@@ -35,6 +35,8 @@ void ObGtsStatistics::reset()
   tenant_id_ = 0;
   last_stat_ts_ = 0;
   gts_rpc_cnt_ = 0;
+  gts_rpc_coalesced_cnt_ = 0;
+  get_gts_by_lease_cnt_ = 0;
   get_gts_cache_cnt_ = 0;
   get_gts_with_stc_cnt_ = 0;
   try_get_gts_cache_cnt_ = 0;
@@ -62,6 +64,8 @@ void ObGtsStatistics::statistics()
       TRANS_LOG(INFO, "gts statistics",
                       K_(tenant_id),
                       "gts_rpc_cnt", ATOMIC_LOAD(&gts_rpc_cnt_),
+                      "gts_rpc_coalesced_cnt", ATOMIC_LOAD(&gts_rpc_coalesced_cnt_),
+                      "get_gts_by_lease_cnt", ATOMIC_LOAD(&get_gts_by_lease_cnt_),
                       "get_gts_cache_cnt", ATOMIC_LOAD(&get_gts_cache_cnt_),
                       "get_gts_with_stc_cnt", ATOMIC_LOAD(&get_gts_with_stc_cnt_),
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
@@ -69,6 +73,8 @@ void ObGtsStatistics::statistics()
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
                       "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_coalesced_cnt_, 0);
+      ATOMIC_STORE(&get_gts_by_lease_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&try_get_gts_cache_cnt_, 0);
@@ -216,6 +222,13 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     gts = tmp_gts;
   } else if (OB_UNLIKELY(OB_EAGAIN != ret)) {
     TRANS_LOG(WARN, "get gts error", KR(ret), K(stc), KP(task));
+  } else if (OB_SUCCESS == gts_local_cache_.get_gts_by_lease(MonotonicTs::current_time(),
+                                                             tmp_gts,
+                                                             receive_gts_ts)) {
+    // the gts leader has granted a lease which is still valid, generate gts locally
+    gts = tmp_gts;
+    ret = OB_SUCCESS;
+    gts_statistics_.inc_get_gts_by_lease_cnt();
   } else {
     TRANS_LOG(DEBUG, "query_gts", KR(ret), K(need_send_rpc), K(stc),
               K(gts_local_cache_.get_latest_srr()));
@@ -287,7 +300,8 @@ int ObGtsSource::get_gts_from_local_timestamp_service_(ObAddr &leader,
   if (OB_ISNULL(timestamp_access)) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(ERROR, "timestamp access is null", KR(ret), KP(timestamp_access), K_(tenant_id), K(leader));
-  } else if (OB_FAIL(timestamp_access->get_number(ObTimeUtility::current_time_ns(), tmp_gts))) {
+  } else if (OB_FAIL(timestamp_access->get_number(ObTimeUtility::current_time_ns()
+                                                   + get_gts_clock_uncertainty_ns(), tmp_gts))) {
     if (EXECUTE_COUNT_PER_SEC(100)) {
       TRANS_LOG(WARN, "global_timestamp_service get gts fail", K(leader), K(tmp_gts), KR(ret));
     }
@@ -398,7 +412,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_
         // rewrite ret
         ret = OB_SUCCESS;
       }
-    } else if (ts > gts) {
+    } else if (ts > get_elapsed_gts_(gts)) {
       tmp_need_wait = true;
     } else {
       tmp_need_wait = false;
@@ -414,7 +428,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_
           if (OB_EAGAIN != tmp_ret && EXECUTE_COUNT_PER_SEC(100)) {
             TRANS_LOG(WARN, "get_gts_from_local_timestamp_service fail", K(leader), K_(server), K(tmp_ret));
           }
-        } else if (ts <= gts) {
+        } else if (ts <= get_elapsed_gts_(gts)) {
           tmp_need_wait = false;
         } else {
           // do nothing
@@ -470,7 +484,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts)
       if (OB_UNLIKELY(OB_EAGAIN != ret)) {
         TRANS_LOG(WARN, "get gts failed", K(ret));
       }
-    } else if (ts > gts) {
+    } else if (ts > get_elapsed_gts_(gts)) {
       ret = OB_EAGAIN;
     } else {
       //do nothing
@@ -488,7 +502,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts)
           if (OB_EAGAIN != tmp_ret) {
             TRANS_LOG(WARN, "get_gts_from_local_timestamp_service fail", K(leader), K_(server), K(tmp_ret));
           }
-        } else if (ts <= gts) {
+        } else if (ts <= get_elapsed_gts_(gts)) {
           ret = OB_SUCCESS;
         } else {
           // do nothing
@@ -597,7 +611,10 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   ObGtsRequest msg;
   const int64_t ts_range_size = 1;
   const MonotonicTs srr = MonotonicTs::current_time();
-  if (OB_FAIL(gts_local_cache_.update_latest_srr(srr))) {
+  if (is_gts_query_inflight_(srr)) {
+    // the inflight request will wake up the waiters, no need to post another one
+    gts_statistics_.inc_gts_rpc_coalesced_cnt();
+  } else if (OB_FAIL(gts_local_cache_.update_latest_srr(srr))) {
     TRANS_LOG(WARN, "update latest srr error", KR(ret), K_(tenant_id), K(srr));
   } else if (OB_FAIL(msg.init(tenant_id_, srr, ts_range_size, server_))) {
     TRANS_LOG(WARN, "msg init failed", KR(ret), K_(tenant_id));
@@ -612,6 +629,24 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   return ret;
 }
 
+// With gts lease enabled, a version is regarded as elapsed only after the local clock
+// exceeds it by the clock uncertainty, see is_gts_lease_enabled
+int64_t ObGtsSource::get_elapsed_gts_(const int64_t gts) const
+{
+  int64_t elapsed_gts = gts;
+  if (is_gts_lease_enabled()) {
+    elapsed_gts = min(gts, ObTimeUtility::current_time_ns() - get_gts_clock_uncertainty_ns());
+  }
+  return elapsed_gts;
+}
+
+bool ObGtsSource::is_gts_query_inflight_(const MonotonicTs now) const
+{
+  const MonotonicTs latest_srr = gts_local_cache_.get_latest_srr();
+  const MonotonicTs srr = gts_local_cache_.get_srr();
+  return latest_srr > srr && now.mts_ - latest_srr.mts_ < GTS_QUERY_COALESCE_INTERVAL_US;
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -655,6 +690,7 @@ void ObGtsSource::statistics_()
 
 int ObGtsSource::update_gts(const MonotonicTs srr,
                             const int64_t gts,
+                            const int64_t gts_end,
                             const MonotonicTs receive_gts_ts,
                             bool &update)
 {
@@ -669,6 +705,9 @@ int ObGtsSource::update_gts(const MonotonicTs srr,
   } else if (OB_FAIL(gts_local_cache_.update_gts(srr, gts, receive_gts_ts, update))) {
     TRANS_LOG(WARN, "gts local cache update error", KR(ret), K(srr), K(gts),
               K(receive_gts_ts), K(update));
+  } else if (gts_end > gts && is_gts_lease_enabled()
+             && OB_FAIL(gts_local_cache_.update_lease(srr, gts_end))) {
+    TRANS_LOG(WARN, "gts local cache update lease error", KR(ret), K(srr), K(gts), K(gts_end));
   } else {
     TRANS_LOG(DEBUG, "gts local cache update success", K(srr), K(gts));
   }
@@ -711,8 +750,21 @@ int ObGtsSource::handle_gts_result(const uint64_t tenant_id, const int64_t queue
     TRANS_LOG(WARN, "get srr and gts failed", KR(ret));
   } else {
     ObGTSTaskQueue *queue = &(queue_[queue_index]);
+    if (queue_index >= WAIT_GTS_QUEUE_START_INDEX) {
+      gts = get_elapsed_gts_(gts);
+    }
     if (OB_FAIL(queue->foreach_task(srr, gts, receive_gts_ts))) {
       TRANS_LOG(WARN, "iterate task failed", KR(ret), K(queue_index));
+    } else if (queue->get_task_count() > 0) {
+      // requests coalesced into the previous round need a newer gts,
+      // query again in batch for all the remaining waiters
+      const bool need_refresh_gts_location = false;
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
+        if (EXECUTE_COUNT_PER_SEC(16)) {
+          TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret), K(queue_index));
+        }
+      }
     }
   }
   return ret;
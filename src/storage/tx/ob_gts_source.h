@@ -45,6 +45,8 @@ public:
   int init(const uint64_t tenant_id);
   void reset();
   void inc_gts_rpc_cnt() { ATOMIC_INC(&gts_rpc_cnt_); }
+  void inc_gts_rpc_coalesced_cnt() { ATOMIC_INC(&gts_rpc_coalesced_cnt_); }
+  void inc_get_gts_by_lease_cnt() { ATOMIC_INC(&get_gts_by_lease_cnt_); }
   void inc_get_gts_cache_cnt() { ATOMIC_INC(&get_gts_cache_cnt_); }
   void inc_get_gts_with_stc_cnt() { ATOMIC_INC(&get_gts_with_stc_cnt_); }
   void inc_try_get_gts_cache_cnt() { ATOMIC_INC(&try_get_gts_cache_cnt_); }
@@ -56,6 +58,8 @@ private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
   int64_t gts_rpc_cnt_;
+  int64_t gts_rpc_coalesced_cnt_;
+  int64_t get_gts_by_lease_cnt_;
 
   int64_t get_gts_cache_cnt_;
   int64_t get_gts_with_stc_cnt_;
@@ -78,7 +82,8 @@ public:
   uint64_t get_tenant_id() const { return tenant_id_; }
   int handle_gts_err_response(const ObGtsErrResponse &msg);
   int handle_gts_result(const uint64_t tenant_id, const int64_t queue_index);
-  int update_gts(const MonotonicTs srr, const int64_t gts, const MonotonicTs receive_gts_ts, bool &update);
+  int update_gts(const MonotonicTs srr, const int64_t gts, const int64_t gts_end,
+                 const MonotonicTs receive_gts_ts, bool &update);
   int get_srr(MonotonicTs &srr);
   int get_latest_srr(MonotonicTs &latest_srr);
   int64_t get_task_count() const;
@@ -100,6 +105,8 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  bool is_gts_query_inflight_(const MonotonicTs now) const;
+  int64_t get_elapsed_gts_(const int64_t gts) const;
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -111,6 +118,9 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  // a gts request posted within this interval whose response has not come back yet
+  // is shared by all the waiters, the response handler will query again if needed
+  static const int64_t GTS_QUERY_COALESCE_INTERVAL_US = 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -16,6 +16,7 @@
 #include "observer/ob_server_struct.h"
 #include "observer/ob_srv_network_frame.h"
 #include "ob_timestamp_access.h"
+#include "ob_gts_define.h"
 #include "storage/tx_storage/ob_ls_map.h"
 #include "storage/tx_storage/ob_ls_service.h"
 
@@ -69,7 +70,8 @@ int ObTimestampService::handle_request(const ObGtsRequest &request, ObGtsRpcResu
      // Go local call to get gts
      TRANS_LOG(DEBUG, "handle local gts request", K(requester));
      ret = handle_local_request_(request, result);
-    } else if (OB_FAIL(get_number(1, ObTimeUtility::current_time_ns(), gts, end_id))) {
+    } else if (OB_FAIL(get_number(1, ObTimeUtility::current_time_ns() + get_gts_clock_uncertainty_ns(),
+                                  gts, end_id))) {
       if (EXECUTE_COUNT_PER_SEC(10)) {
         TRANS_LOG(WARN, "get timestamp failed", KR(ret));
       }
@@ -85,7 +87,9 @@ int ObTimestampService::handle_request(const ObGtsRequest &request, ObGtsRpcResu
         TRANS_LOG(DEBUG, "post gts err response success", K(response));
       }
     } else {
-      if (OB_FAIL(result.init(tenant_id, ret, srr, gts, gts))) {
+      // grant the requester a lease to generate gts locally, see is_gts_lease_enabled
+      const int64_t gts_end = is_gts_lease_enabled() ? gts + get_gts_lease_time_us() * 1000 : gts;
+      if (OB_FAIL(result.init(tenant_id, ret, srr, gts, gts_end))) {
         TRANS_LOG(WARN, "gts result init failed", KR(ret), K(request));
       }
     }
@@ -119,7 +123,8 @@ int ObTimestampService::handle_local_request_(const ObGtsRequest &request, obrpc
   const uint64_t tenant_id = request.get_tenant_id();
   const MonotonicTs srr = request.get_srr();
   int64_t end_id = 0;
-  if (OB_FAIL(get_number(1, ObTimeUtility::current_time_ns(), gts, end_id))) {
+  if (OB_FAIL(get_number(1, ObTimeUtility::current_time_ns() + get_gts_clock_uncertainty_ns(),
+                         gts, end_id))) {
     if (EXECUTE_COUNT_PER_SEC(10)) {
       TRANS_LOG(WARN, "get timestamp failed", KR(ret));
     }
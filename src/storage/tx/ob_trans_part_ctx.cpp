@@ -5860,6 +5860,13 @@ int ObPartTransCtx::do_local_commit_tx_()
 
   if (OB_FAIL(generate_commit_version_())) {
     if (OB_EAGAIN == ret) {
+      // gts is being fetched asynchronously, flush the pending redo in the meantime
+      // so that the commit log only carries the tail when gts callback arrives.
+      // the ctx lock is held here, so the guards of submit_redo_log are repeated
+      if (ObTxState::INIT == get_downstream_state() && !final_log_cb_.is_valid()) {
+        (void)mt_ctx_.merge_multi_callback_lists_for_immediate_logging();
+        (void)submit_log_impl_(ObTxLogType::TX_REDO_LOG);
+      }
       ret = OB_SUCCESS;
     } else {
       TRANS_LOG(WARN, "generate commit version failed", KR(ret), K(*this));
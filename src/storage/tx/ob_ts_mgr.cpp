@@ -545,6 +545,7 @@ int ObTsMgr::handle_gts_result(const uint64_t tenant_id, const int64_t queue_ind
 int ObTsMgr::update_gts(const uint64_t tenant_id,
                         const MonotonicTs srr,
                         const int64_t gts,
+                        const int64_t gts_end,
                         const int ts_type,
                         bool &update)
 {
@@ -580,7 +581,7 @@ int ObTsMgr::update_gts(const uint64_t tenant_id,
       if (OB_ISNULL(gts_source = ts_source_info->get_gts_source())) {
         ret = OB_ERR_UNEXPECTED;
         TRANS_LOG(WARN, "gts source is NULL", KR(ret), K(tenant_id));
-      } else if (OB_FAIL(gts_source->update_gts(srr, gts, receive_gts_ts, update))) {
+      } else if (OB_FAIL(gts_source->update_gts(srr, gts, gts_end, receive_gts_ts, update))) {
         TRANS_LOG(WARN, "update gts cache failed", KR(ret), K(tenant_id), K(srr), K(gts));
       } else {
         // do nothing
@@ -341,7 +341,8 @@ public:
 
   int handle_gts_err_response(const ObGtsErrResponse &msg);
   int handle_gts_result(const uint64_t tenant_id, const int64_t queue_index, const int ts_type);
-  int update_gts(const uint64_t tenant_id, const MonotonicTs srr, const int64_t gts, const int ts_type, bool &update);
+  int update_gts(const uint64_t tenant_id, const MonotonicTs srr, const int64_t gts,
+                 const int64_t gts_end, const int ts_type, bool &update);
   int delete_tenant(const uint64_t tenant_id);
 public:
   int update_gts(const uint64_t tenant_id, const int64_t gts, bool &update);
@@ -60,6 +60,8 @@ int ObTxDataTable::init(ObLS *ls, ObTxCtxTable *tx_ctx_table)
   } else if (FALSE_IT(arena_allocator_.set_attr(mem_attr_))) {
   } else if (OB_FAIL(init_tx_data_read_schema_())) {
     STORAGE_LOG(WARN, "init tx data read ctx failed.", KR(ret), K(tablet_id_));
+  } else if (OB_FAIL(result_cache_.init(mem_attr_))) {
+    STORAGE_LOG(WARN, "init tx data result cache failed.", KR(ret), K(tablet_id_));
   } else {
     slice_allocator_.set_nway(ObTxDataTable::TX_DATA_MAX_CONCURRENCY);
 
@@ -184,6 +186,7 @@ void ObTxDataTable::reset()
   memtable_mgr_ = nullptr;
   tx_ctx_table_ = nullptr;
   memtables_cache_.reuse();
+  result_cache_.destroy();
   slice_allocator_.purge_extra_cached_block(0);
   is_started_ = false;
   is_inited_ = false;
@@ -208,6 +211,7 @@ int ObTxDataTable::offline()
     min_start_log_ts_in_ctx_ = 0;
     last_update_min_start_log_ts_ = 0;
     calc_upper_trans_version_cache_.reset();
+    result_cache_.clear();
   }
   return ret;  
 }
@@ -501,6 +505,9 @@ int ObTxDataTable::check_with_tx_data(const ObTransID tx_id, ObITxDataCheckFunct
   } else if (OB_SUCC(check_tx_data_in_memtable_(tx_id, fn))) {
     // successfully do check function in memtable, check done
     STORAGE_LOG(DEBUG, "tx data table check with tx memtable data succeed", K(tx_id), K(fn));
+  } else if (OB_TRANS_CTX_NOT_EXIST == ret && OB_SUCC(check_tx_data_in_result_cache_(tx_id, fn))) {
+    // successfully do check function with the cached sstable result
+    STORAGE_LOG(DEBUG, "tx data table check with tx result cache succeed", K(tx_id), K(fn));
   } else if (OB_TRANS_CTX_NOT_EXIST == ret && OB_SUCC(check_tx_data_in_sstable_(tx_id, fn))) {
     // successfully do check function in sstable
     STORAGE_LOG(DEBUG, "tx data table check with tx sstable data succeed", K(tx_id), K(fn));
@@ -650,6 +657,7 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
   } else if (OB_ISNULL(tx_data)) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(ERROR, "unexpected nullptr of tx data", KR(ret), K(tx_id));
+  } else if (FALSE_IT(result_cache_.put(*tx_data))) {
   } else if (OB_FAIL(fn(*tx_data))) {
     STORAGE_LOG(WARN, "check tx data in sstable failed.", KR(ret), KP(this), K(tablet_id_));
   }
@@ -661,6 +669,25 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
   return ret;
 }
 
+// Tx data of a decided transaction in sstable never changes, so the check function can be done with
+// the cached copy. OB_TRANS_CTX_NOT_EXIST is returned if the tx data is not cached.
+int ObTxDataTable::check_tx_data_in_result_cache_(const ObTransID tx_id, ObITxDataCheckFunctor &fn)
+{
+  int ret = OB_SUCCESS;
+  ObTxData tx_data;
+
+  if (OB_FAIL(result_cache_.get(tx_id, tx_data))) {
+    ret = OB_TRANS_CTX_NOT_EXIST;
+  } else if (OB_FAIL(fn(tx_data))) {
+    STORAGE_LOG(WARN, "check tx data in result cache failed.", KR(ret), KP(this), K(tablet_id_), K(tx_data));
+  }
+
+  if (REACH_TIME_INTERVAL(10 * 1000 * 1000 /*10s*/)) {
+    STORAGE_LOG(INFO, "tx data result cache statistics", K(get_ls_id()), K_(result_cache));
+  }
+  return ret;
+}
+
 int ObTxDataTable::get_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObTxData *&tx_data)
 {
   int ret = OB_SUCCESS;
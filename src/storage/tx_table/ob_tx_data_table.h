@@ -115,7 +115,8 @@ public:  // ObTxDataTable
       memtable_mgr_(nullptr),
       tx_ctx_table_(nullptr),
       read_schema_(),
-      memtables_cache_() {}
+      memtables_cache_(),
+      result_cache_() {}
   ~ObTxDataTable() {}
 
   virtual int init(ObLS *ls, ObTxCtxTable *tx_ctx_table);
@@ -221,7 +222,8 @@ public:  // ObTxDataTable
                KP_(ls),
                KP_(ls_tablet_svr),
                KP_(memtable_mgr),
-               KP_(tx_ctx_table));
+               KP_(tx_ctx_table),
+               K_(result_cache));
 
 public: // getter and setter
   SliceAllocator *get_slice_allocator() { return &slice_allocator_; }
@@ -242,6 +244,8 @@ private:
 
   int check_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
 
+  int check_tx_data_in_result_cache_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
+
   int get_tx_data_in_cache_(const transaction::ObTransID tx_id, ObTxData *&tx_data);
 
   int get_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObTxData *&tx_data);
@@ -333,6 +337,8 @@ private:
   TxDataReadSchema read_schema_;
   CalcUpperTransVersionCache calc_upper_trans_version_cache_;
   MemtableHandlesCache memtables_cache_;
+  // Decided tx data read from the tx data sstable, see ObTxDataResultCache
+  ObTxDataResultCache result_cache_;
 };  // tx_table
 
 
@@ -394,6 +394,100 @@ bool ObCommitVersionsArray::is_valid()
 }
 
 
+int ObTxDataResultCache::init(const common::ObMemAttr &mem_attr)
+{
+  int ret = OB_SUCCESS;
+  STATIC_ASSERT(0 == (SLOT_CNT & (SLOT_CNT - 1)), "slot count should be power of 2");
+
+  if (OB_NOT_NULL(slots_)) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "tx data result cache init twice", KR(ret), KPC(this));
+  } else if (OB_ISNULL(slots_ = static_cast<Slot *>(ob_malloc(sizeof(Slot) * SLOT_CNT, mem_attr)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "allocate tx data result cache failed", KR(ret));
+  } else {
+    clear();
+  }
+  return ret;
+}
+
+void ObTxDataResultCache::destroy()
+{
+  if (OB_NOT_NULL(slots_)) {
+    ob_free(slots_);
+    slots_ = nullptr;
+  }
+  hit_cnt_ = 0;
+  miss_cnt_ = 0;
+}
+
+void ObTxDataResultCache::clear()
+{
+  if (OB_NOT_NULL(slots_)) {
+    for (int64_t i = 0; i < SLOT_CNT; i++) {
+      Slot &slot = slots_[i];
+      // bump the sequence so that concurrent readers of a cleared slot see a miss
+      const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+      ATOMIC_STORE(&slot.seq_, (seq | 1) + 1);
+      ATOMIC_STORE(&slot.tx_id_, 0);
+    }
+  }
+}
+
+bool ObTxDataResultCache::can_cache(const ObTxData &tx_data)
+{
+  return (ObTxData::COMMIT == tx_data.state_ || ObTxData::ABORT == tx_data.state_)
+         && OB_ISNULL(tx_data.undo_status_list_.head_)
+         && tx_data.tx_id_.is_valid();
+}
+
+void ObTxDataResultCache::put(const ObTxData &tx_data)
+{
+  if (OB_NOT_NULL(slots_) && can_cache(tx_data)) {
+    Slot *slot = get_slot_(tx_data.tx_id_);
+    const int64_t seq = ATOMIC_LOAD(&slot->seq_);
+    if (0 == (seq & 1) && ATOMIC_BCAS(&slot->seq_, seq, seq + 1)) {
+      ATOMIC_STORE(&slot->tx_id_, tx_data.tx_id_.get_id());
+      ATOMIC_STORE(&slot->state_, tx_data.state_);
+      ATOMIC_STORE(&slot->commit_version_, tx_data.commit_version_);
+      ATOMIC_STORE(&slot->start_log_ts_, tx_data.start_log_ts_);
+      ATOMIC_STORE(&slot->end_log_ts_, tx_data.end_log_ts_);
+      ATOMIC_STORE(&slot->seq_, seq + 2);
+    }
+  }
+}
+
+int ObTxDataResultCache::get(const transaction::ObTransID tx_id, ObTxData &tx_data)
+{
+  int ret = OB_ENTRY_NOT_EXIST;
+  if (OB_NOT_NULL(slots_)) {
+    Slot *slot = get_slot_(tx_id);
+    const int64_t seq = ATOMIC_LOAD(&slot->seq_);
+    if (0 == (seq & 1) && tx_id.get_id() == ATOMIC_LOAD(&slot->tx_id_)) {
+      const int64_t state = ATOMIC_LOAD(&slot->state_);
+      const int64_t commit_version = ATOMIC_LOAD(&slot->commit_version_);
+      const int64_t start_log_ts = ATOMIC_LOAD(&slot->start_log_ts_);
+      const int64_t end_log_ts = ATOMIC_LOAD(&slot->end_log_ts_);
+      if (seq == ATOMIC_LOAD(&slot->seq_)) {
+        tx_data.reset();
+        tx_data.tx_id_ = tx_id;
+        tx_data.state_ = static_cast<int32_t>(state);
+        tx_data.is_in_tx_data_table_ = true;
+        tx_data.commit_version_ = commit_version;
+        tx_data.start_log_ts_ = start_log_ts;
+        tx_data.end_log_ts_ = end_log_ts;
+        ret = OB_SUCCESS;
+      }
+    }
+  }
+  if (OB_SUCCESS == ret) {
+    ATOMIC_INC(&hit_cnt_);
+  } else {
+    ATOMIC_INC(&miss_cnt_);
+  }
+  return ret;
+}
+
 } // end namespace transaction
 } // end namespace oceanbase
 
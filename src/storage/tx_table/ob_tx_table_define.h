@@ -286,6 +286,67 @@ public:
   ObCommitVersionsArray commit_versions_;
 };
 
+// A small direct-mapped cache of decided tx data read from the tx data sstable. The sstable row of
+// a committed or aborted transaction never changes, so repeated visibility checks against the same
+// transaction (which is the common case when scanning rows written by one big transaction) can be
+// answered without building a row getter on the tx data sstable.
+//
+// Only transactions without undo actions are cached, so that a slot can be described by a few
+// scalar fields. Each slot is protected by a sequence number: readers never block and simply treat
+// a concurrently modified slot as a miss, writers give up if the slot is being written by others.
+class ObTxDataResultCache
+{
+public:
+  static const int64_t SLOT_CNT = 2048;
+
+  ObTxDataResultCache() : slots_(nullptr), hit_cnt_(0), miss_cnt_(0) {}
+  ~ObTxDataResultCache() { destroy(); }
+
+  int init(const common::ObMemAttr &mem_attr);
+  void destroy();
+  void clear();
+
+  /**
+   * @brief Put the tx data into cache if it is decided and has no undo actions.
+   */
+  void put(const ObTxData &tx_data);
+
+  /**
+   * @brief Fill tx_data with the cached result.
+   *
+   * @return OB_SUCCESS on hit, OB_ENTRY_NOT_EXIST on miss
+   */
+  int get(const transaction::ObTransID tx_id, ObTxData &tx_data);
+
+  static bool can_cache(const ObTxData &tx_data);
+  int64_t get_hit_cnt() const { return ATOMIC_LOAD(&hit_cnt_); }
+  int64_t get_miss_cnt() const { return ATOMIC_LOAD(&miss_cnt_); }
+
+  TO_STRING_KV(KP_(slots), K_(hit_cnt), K_(miss_cnt));
+
+private:
+  struct Slot
+  {
+    // odd means the slot is being written
+    int64_t seq_;
+    int64_t tx_id_;
+    int64_t state_;
+    int64_t commit_version_;
+    int64_t start_log_ts_;
+    int64_t end_log_ts_;
+  };
+
+  Slot *get_slot_(const transaction::ObTransID tx_id) const
+  {
+    return &slots_[tx_id.hash() & (SLOT_CNT - 1)];
+  }
+
+private:
+  Slot *slots_;
+  int64_t hit_cnt_;
+  int64_t miss_cnt_;
+};
+
 } // storage
 } // oceanbase
 
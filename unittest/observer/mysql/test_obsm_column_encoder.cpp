@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/utility/ob_test_util.h"
+#include "observer/mysql/obsm_row.h"
+#include "observer/mysql/obsm_utils.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+class TestObSMColumnEncoder : public ::testing::Test
+{
+public:
+  TestObSMColumnEncoder() {}
+  virtual ~TestObSMColumnEncoder() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  void check_same_encoding(MYSQL_PROTOCOL_TYPE type);
+protected:
+  static const int64_t COLUMN_CNT = 5;
+  ObObj cells_[COLUMN_CNT];
+  ObSEArray<ObField, COLUMN_CNT> fields_;
+};
+
+void TestObSMColumnEncoder::check_same_encoding(MYSQL_PROTOCOL_TYPE type)
+{
+  ObDataTypeCastParams dtc_params;
+  ObSEArray<ObSMColumnEncoder, COLUMN_CNT> encoders;
+  ASSERT_EQ(OB_SUCCESS, ObSMUtils::init_column_encoders(fields_, dtc_params, encoders));
+  ASSERT_EQ(COLUMN_CNT, encoders.count());
+  ObNewRow row;
+  row.assign(cells_, COLUMN_CNT);
+  char expect_buf[1024];
+  char buf[1024];
+  int64_t expect_pos = 0;
+  int64_t pos = 0;
+  ObSMRow expect_row(type, row, dtc_params, &fields_);
+  ObSMRow sm_row(type, row, dtc_params, &fields_);
+  sm_row.set_column_encoders(encoders.get_data(), encoders.count());
+  ASSERT_EQ(OB_SUCCESS, expect_row.serialize(expect_buf, sizeof(expect_buf), expect_pos));
+  ASSERT_EQ(OB_SUCCESS, sm_row.serialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(expect_pos, pos);
+  ASSERT_EQ(0, MEMCMP(expect_buf, buf, pos));
+  // fails without partial output on a short buffer
+  pos = 0;
+  ASSERT_NE(OB_SUCCESS, sm_row.serialize(buf, expect_pos - 1, pos));
+  ASSERT_EQ(0, pos);
+}
+
+TEST_F(TestObSMColumnEncoder, same_as_cell_str)
+{
+  ObField field;
+  field.type_.set_type(ObIntType);
+  ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+  field.type_.set_type(ObDoubleType);
+  field.accuracy_.set_scale(2);
+  ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+  field.type_.set_type(ObVarcharType);
+  field.accuracy_.set_scale(0);
+  ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+  field.type_.set_type(ObDateType);
+  ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+  field.type_.set_type(ObIntType);
+  field.flags_ = ZEROFILL_FLAG;
+  field.length_ = 8;
+  ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+
+  cells_[0].set_int(-42);
+  cells_[1].set_double(3.1415);
+  cells_[2].set_varchar("export style result row");
+  cells_[3].set_date(19000);
+  cells_[4].set_int(7);
+  check_same_encoding(TEXT);
+  check_same_encoding(BINARY);
+
+  // cells not of the field type class fall back to cell_str
+  cells_[0].set_null();
+  cells_[2].set_int(1);
+  check_same_encoding(TEXT);
+  check_same_encoding(BINARY);
+}
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_obsm_column_encoder.log", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -29,6 +29,14 @@ public:
     MTL(oceanbase::share::detector::ObDeadLockDetectorMgr*)->process_lcl_message(lcl_msg);
     return OB_SUCCESS;
   }
+  int post_lcl_batch_message(const ObAddr &dest_addr, const ObLCLBatchMessage &batch_msg) override
+  {
+    UNUSED(dest_addr);
+    for (int64_t idx = 0; idx < batch_msg.count(); ++idx) {
+      MTL(oceanbase::share::detector::ObDeadLockDetectorMgr*)->process_lcl_message(batch_msg.at(idx));
+    }
+    return OB_SUCCESS;
+  }
   int post_collect_info_message(const ObAddr &dest_addr,
                                 const ObDeadLockCollectInfoMessage &collect_info_msg) override
   {
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "share/deadlock/ob_deadlock_detector_mgr.h"
+#include "share/deadlock/ob_deadlock_detector_rpc.h"
+#include "share/ob_cluster_version.h"
+#include "share/config/ob_server_config.h"
+
+namespace oceanbase {
+namespace unittest {
+
+using namespace common;
+using namespace share::detector;
+
+// records the posted messages instead of sending them
+class RecordLCLRpc : public ObDeadLockDetectorRpc
+{
+public:
+  struct PostRecord
+  {
+    PostRecord() : addr_(), msg_cnt_(0), is_batch_(false) {}
+    PostRecord(const ObAddr &addr, const int64_t msg_cnt, const bool is_batch)
+      : addr_(addr), msg_cnt_(msg_cnt), is_batch_(is_batch) {}
+    TO_STRING_KV(K_(addr), K_(msg_cnt), K_(is_batch));
+    ObAddr addr_;
+    int64_t msg_cnt_;
+    bool is_batch_;
+  };
+  int post_lcl_message(const ObAddr &dest_addr, const ObLCLMessage &lcl_msg) override
+  {
+    UNUSED(lcl_msg);
+    return records_.push_back(PostRecord(dest_addr, 1, false));
+  }
+  int post_lcl_batch_message(const ObAddr &dest_addr, const ObLCLBatchMessage &batch_msg) override
+  {
+    return records_.push_back(PostRecord(dest_addr, batch_msg.count(), true));
+  }
+  ObArray<PostRecord> records_;
+};
+
+class TestLCLBatchSender : public ::testing::Test
+{
+public:
+  TestLCLBatchSender() {}
+  ~TestLCLBatchSender() {}
+  // runs under the real min cluster version of this build, the batch rpc is gated by config
+  virtual void SetUp()
+  {
+    mgr_.rpc_ = &rpc_;
+    ObClusterVersion::get_instance().update_cluster_version(CLUSTER_CURRENT_VERSION);
+  }
+  virtual void TearDown()
+  {
+    mgr_.rpc_ = nullptr;
+    GCONF._enable_lcl_batch_message.set_value("False");
+  }
+  // msg_cnt messages to each of addrs, interleaved
+  void fill_msgs(const ObIArray<ObAddr> &addrs, const int64_t msg_cnt, ObArray<ObLCLMessage> &msgs)
+  {
+    for (int64_t i = 0; i < msg_cnt; ++i) {
+      for (int64_t j = 0; j < addrs.count(); ++j) {
+        ObLCLMessage msg;
+        msg.dest_addr_ = addrs.at(j);
+        ASSERT_EQ(OB_SUCCESS, msgs.push_back(msg));
+      }
+    }
+  }
+  ObDeadLockDetectorMgr mgr_;
+  RecordLCLRpc rpc_;
+};
+
+TEST_F(TestLCLBatchSender, group_by_server)
+{
+  GCONF._enable_lcl_batch_message.set_value("True");
+  ObArray<ObAddr> addrs;
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.1", 2882)));
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.2", 2882)));
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.3", 2882)));
+  ObArray<ObLCLMessage> msgs;
+  fill_msgs(addrs, 3, msgs);
+  // a lone message still goes by the single message rpc
+  ObLCLMessage lone_msg;
+  lone_msg.dest_addr_ = ObAddr(ObAddr::IPV4, "127.0.0.4", 2882);
+  ASSERT_EQ(OB_SUCCESS, msgs.push_back(lone_msg));
+
+  mgr_.sender_thread_.send_msgs_(msgs);
+  ASSERT_EQ(4, rpc_.records_.count());
+  for (int64_t i = 0; i < addrs.count(); ++i) {
+    EXPECT_TRUE(rpc_.records_.at(i).is_batch_);
+    EXPECT_EQ(3, rpc_.records_.at(i).msg_cnt_);
+    EXPECT_EQ(addrs.at(i), rpc_.records_.at(i).addr_);
+  }
+  EXPECT_FALSE(rpc_.records_.at(3).is_batch_);
+  EXPECT_EQ(lone_msg.get_addr(), rpc_.records_.at(3).addr_);
+  EXPECT_EQ(4, mgr_.sender_thread_.rpc_count_);
+  EXPECT_EQ(10, mgr_.sender_thread_.remote_msg_count_);
+}
+
+TEST_F(TestLCLBatchSender, flush_when_full)
+{
+  GCONF._enable_lcl_batch_message.set_value("True");
+  ObArray<ObAddr> addrs;
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.1", 2882)));
+  ObArray<ObLCLMessage> msgs;
+  const int64_t max_cnt = ObLCLBatchMessage::MAX_MSG_CNT_PER_BATCH;
+  fill_msgs(addrs, 2 * max_cnt + 2, msgs);
+
+  mgr_.sender_thread_.send_msgs_(msgs);
+  ASSERT_EQ(3, rpc_.records_.count());
+  EXPECT_EQ(max_cnt, rpc_.records_.at(0).msg_cnt_);
+  EXPECT_EQ(max_cnt, rpc_.records_.at(1).msg_cnt_);
+  EXPECT_EQ(2, rpc_.records_.at(2).msg_cnt_);
+  for (int64_t i = 0; i < rpc_.records_.count(); ++i) {
+    EXPECT_TRUE(rpc_.records_.at(i).is_batch_);
+  }
+}
+
+TEST_F(TestLCLBatchSender, no_batch_by_default)
+{
+  // the default config keeps the single message rpc
+  ASSERT_FALSE(GCONF._enable_lcl_batch_message);
+  ObArray<ObAddr> addrs;
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.1", 2882)));
+  ASSERT_EQ(OB_SUCCESS, addrs.push_back(ObAddr(ObAddr::IPV4, "127.0.0.2", 2882)));
+  ObArray<ObLCLMessage> msgs;
+  fill_msgs(addrs, 5, msgs);
+
+  mgr_.sender_thread_.send_msgs_(msgs);
+  ASSERT_EQ(10, rpc_.records_.count());
+  for (int64_t i = 0; i < rpc_.records_.count(); ++i) {
+    EXPECT_FALSE(rpc_.records_.at(i).is_batch_);
+  }
+  EXPECT_EQ(10, mgr_.sender_thread_.rpc_count_);
+}
+
+}// namespace unittest
+}// namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_lcl_batch_sender.log");
+  oceanbase::common::ObLogger &logger = oceanbase::common::ObLogger::get_logger();
+  logger.set_file_name("test_lcl_batch_sender.log", false);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,410 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#define protected public
+#include "sql/das/ob_data_access_service.h"
+#include "sql/das/ob_das_async_access.h"
+#include "sql/das/ob_das_ref.h"
+#include "sql/das/ob_das_scan_op.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "share/config/ob_server_config.h"
+#include "share/rc/ob_tenant_base.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase {
+namespace unittest {
+
+using namespace common;
+using namespace share;
+using namespace sql;
+
+typedef std::pair<ObAddr, int64_t> PostInfo; // runner server and the task op count
+
+// simulates the remote servers, the task ops sent by one rpc are executed by the runner
+// and the response is returned to the controller
+class MockDataAccessService : public ObDataAccessService
+{
+public:
+  MockDataAccessService() : executed_limit_(INT64_MAX) {}
+  virtual int remote_sync_access(const ObAddr &runner_svr,
+                                 const uint64_t tenant_id,
+                                 const int64_t timeout,
+                                 const ObDASTaskArg &task_arg,
+                                 ObDASTaskResp &task_resp) override
+  {
+    UNUSED(tenant_id);
+    UNUSED(timeout);
+    sync_posts_.push_back(PostInfo(runner_svr, task_arg.get_task_ops().count()));
+    run_task_ops(task_arg.get_task_ops(), task_resp);
+    return OB_SUCCESS;
+  }
+  virtual int remote_async_access(const ObAddr &runner_svr,
+                                  const uint64_t tenant_id,
+                                  const int64_t timeout,
+                                  const ObDASTaskArg &task_arg,
+                                  ObDASAsyncAccessCB *cb) override
+  {
+    UNUSED(tenant_id);
+    UNUSED(timeout);
+    async_posts_.push_back(PostInfo(runner_svr, task_arg.get_task_ops().count()));
+    // the response arrives while the worker executes other tasks or waits
+    rpc_threads_.push_back(std::thread([this, cb]() {
+      ::usleep(50 * 1000);
+      run_task_ops(cb->get_task_ops(), cb->get_task_resp());
+      cb->rcode_.rcode_ = OB_SUCCESS;
+      cb->process();
+    }));
+    return OB_SUCCESS;
+  }
+  void run_task_ops(const ObIArray<ObIDASTaskOp*> &task_ops, ObDASTaskResp &task_resp)
+  {
+    for (int64_t i = 0; i < task_ops.count() && i < executed_limit_; ++i) {
+      task_resp.get_op_results().at(i)->set_task_id(task_ops.at(i)->get_task_id());
+      task_resp.add_op_has_more(false);
+    }
+    task_resp.set_err_code(OB_SUCCESS);
+  }
+  void join_rpc_threads()
+  {
+    for (int64_t i = 0; i < rpc_threads_.size(); ++i) {
+      rpc_threads_.at(i).join();
+    }
+    rpc_threads_.clear();
+  }
+  int64_t executed_limit_; // count of task ops executed by the runner in one rpc
+  std::vector<PostInfo> sync_posts_;
+  std::vector<PostInfo> async_posts_;
+  std::vector<std::thread> rpc_threads_;
+};
+
+class MockDASResult : public ObIDASTaskResult
+{
+public:
+  MockDASResult() : size_(0) {}
+  virtual int init(const ObIDASTaskOp &task_op) override { UNUSED(task_op); return OB_SUCCESS; }
+  virtual int64_t get_serialize_size() const override { return size_; }
+  int64_t size_;
+};
+
+// the task op executed by the runner, its result takes result_size_ bytes of the response
+class MockDASOp : public ObIDASTaskOp
+{
+public:
+  MockDASOp(ObIAllocator &op_alloc, ObDASTaskResultMgr &result_mgr)
+    : ObIDASTaskOp(op_alloc),
+      result_size_(0),
+      has_more_(false),
+      fill_ret_(OB_SUCCESS),
+      memory_limit_(-1),
+      result_mgr_(result_mgr)
+  {}
+  virtual int open_op() override { return OB_SUCCESS; }
+  virtual int release_op() override { return OB_SUCCESS; }
+  virtual int decode_task_result(ObIDASTaskResult *task_result) override
+  {
+    UNUSED(task_result);
+    return OB_SUCCESS;
+  }
+  virtual int fill_task_result(ObIDASTaskResult &task_result,
+                               bool &has_more,
+                               const int64_t memory_limit) override
+  {
+    memory_limit_ = memory_limit;
+    static_cast<MockDASResult&>(task_result).size_ = result_size_;
+    has_more = has_more_;
+    return fill_ret_;
+  }
+  // the rest rows are saved in the result manager of the runner, same as ObDASScanOp
+  virtual int fill_extra_result() override
+  {
+    int ret = OB_SUCCESS;
+    ObDASTCB *tcb = op_alloc(ObDASTCB);
+    if (OB_ISNULL(tcb)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else if (FALSE_IT(tcb->task_id_ = task_id_)) {
+    } else if (OB_FAIL(result_mgr_.tcb_map_.insert_and_get(DASTCBInfo(task_id_), tcb))) {
+      op_free(tcb);
+    } else {
+      result_mgr_.tcb_map_.revert(tcb);
+    }
+    return ret;
+  }
+  virtual int init_task_info() override { return OB_SUCCESS; }
+  virtual int swizzling_remote_task(ObDASRemoteInfo *remote_info) override
+  {
+    UNUSED(remote_info);
+    return OB_SUCCESS;
+  }
+  bool is_executed() const { return memory_limit_ >= 0; }
+  int64_t result_size_;
+  bool has_more_;
+  int fill_ret_;
+  int64_t memory_limit_; // the byte budget given by the runner, -1 if not executed
+  ObDASTaskResultMgr &result_mgr_;
+};
+
+class TestDASAsyncAccess : public ::testing::Test
+{
+public:
+  TestDASAsyncAccess()
+    : allocator_("TestDASAsync"),
+      tenant_base_(1),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      pd_expr_spec_(allocator_),
+      pd_expr_op_(eval_ctx_, pd_expr_spec_),
+      scan_ctdef_(allocator_),
+      scan_rtdef_(),
+      das_ref_(eval_ctx_, exec_ctx_),
+      ctrl_addr_(ObAddr::IPV4, "127.0.0.1", 2882),
+      svr1_(ObAddr::IPV4, "127.0.0.2", 2882),
+      svr2_(ObAddr::IPV4, "127.0.0.3", 2882)
+  {}
+  ~TestDASAsyncAccess() {}
+  virtual void SetUp()
+  {
+    ObDataAccessService *das = &das_;
+    tenant_base_.set(das);
+    ObTenantEnv::set_tenant(&tenant_base_);
+    das_.ctrl_addr_ = ctrl_addr_;
+    ASSERT_EQ(OB_SUCCESS, das_.task_result_mgr_.init());
+    ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, NULL));
+    exec_ctx_.set_my_session(&session_);
+    ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_physical_plan_ctx());
+    exec_ctx_.get_physical_plan_ctx()->set_timeout_timestamp(
+        ObTimeUtility::current_time() + 10 * 1000 * 1000);
+    scan_rtdef_.p_pd_expr_op_ = &pd_expr_op_;
+  }
+  virtual void TearDown()
+  {
+    das_.join_rpc_threads();
+    das_ref_.reset();
+    GCONF._enable_das_async_access.set_value("False");
+  }
+  // same as ObDASRef::create_das_task except for the das task id
+  void add_scan_task(const ObDASTabletLoc &tablet_loc)
+  {
+    ObIDASTaskOp *task_op = nullptr;
+    ASSERT_EQ(OB_SUCCESS, das_ref_.get_das_factory().create_das_task_op(DAS_OP_TABLE_SCAN, task_op));
+    ObDASScanOp *scan_op = static_cast<ObDASScanOp*>(task_op);
+    scan_op->set_scan_ctdef(&scan_ctdef_);
+    scan_op->set_scan_rtdef(&scan_rtdef_);
+    task_op->set_snapshot(&exec_ctx_.get_das_ctx().get_snapshot());
+    task_op->set_tenant_id(1);
+    task_op->set_task_id(das_ref_.get_das_task_cnt() + 1);
+    task_op->set_tablet_id(tablet_loc.tablet_id_);
+    task_op->set_ls_id(tablet_loc.ls_id_);
+    task_op->set_tablet_loc(&tablet_loc);
+    ASSERT_EQ(OB_SUCCESS, das_ref_.add_batched_task(task_op));
+  }
+  // the result of each task op is decoded after the response is collected
+  void check_all_task_decoded()
+  {
+    DASTaskIter task_iter = das_ref_.begin_task_iter();
+    for (; !task_iter.is_end(); ++task_iter) {
+      ObDASScanOp *scan_op = static_cast<ObDASScanOp*>(*task_iter);
+      ASSERT_TRUE(nullptr != scan_op->result_);
+      ASSERT_EQ(scan_op->get_task_id(),
+                static_cast<ObDASScanResult*>(scan_op->result_)->get_task_id());
+    }
+  }
+  // the task op and its result as deserialized by the access processor of the runner
+  MockDASOp *add_mock_task(ObIArray<ObIDASTaskOp*> &task_ops,
+                           ObDASTaskResp &task_resp,
+                           const int64_t result_size)
+  {
+    void *op_buf = allocator_.alloc(sizeof(MockDASOp));
+    void *result_buf = allocator_.alloc(sizeof(MockDASResult));
+    EXPECT_TRUE(nullptr != op_buf && nullptr != result_buf);
+    MockDASOp *task_op = new (op_buf) MockDASOp(allocator_, das_.task_result_mgr_);
+    task_op->set_task_id(task_ops.count() + 1);
+    task_op->result_size_ = result_size;
+    EXPECT_EQ(OB_SUCCESS, task_ops.push_back(task_op));
+    EXPECT_EQ(OB_SUCCESS, task_resp.add_op_result(new (result_buf) MockDASResult()));
+    return task_op;
+  }
+  ObArenaAllocator allocator_;
+  MockDataAccessService das_;
+  ObTenantBase tenant_base_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObPushdownExprSpec pd_expr_spec_;
+  ObPushdownOperator pd_expr_op_;
+  ObDASScanCtDef scan_ctdef_;
+  ObDASScanRtDef scan_rtdef_;
+  ObDASRef das_ref_;
+  ObAddr ctrl_addr_;
+  ObAddr svr1_;
+  ObAddr svr2_;
+};
+
+TEST_F(TestDASAsyncAccess, disabled_by_default)
+{
+  ObDASTabletLoc loc1;
+  ObDASTabletLoc loc2;
+  loc1.server_ = svr1_;
+  loc2.server_ = svr2_;
+  add_scan_task(loc1);
+  add_scan_task(loc2);
+  ASSERT_FALSE(GCONF._enable_das_async_access);
+  ASSERT_FALSE(das_ref_.need_async_access());
+  ASSERT_EQ(OB_SUCCESS, das_ref_.execute_all_task());
+  ASSERT_EQ(0, das_.async_posts_.size());
+  ASSERT_EQ(2, das_.sync_posts_.size());
+  check_all_task_decoded();
+}
+
+TEST_F(TestDASAsyncAccess, async_access)
+{
+  GCONF._enable_das_async_access.set_value("True");
+  ObDASTabletLoc loc1;
+  ObDASTabletLoc loc2;
+  ObDASTabletLoc loc3;
+  loc1.server_ = svr1_;
+  loc2.server_ = svr2_;
+  loc3.server_ = svr1_;
+  add_scan_task(loc1);
+  add_scan_task(loc2);
+  add_scan_task(loc3);
+  ASSERT_TRUE(das_ref_.need_async_access());
+  // the worker returns after all responses arrive and are collected
+  ASSERT_EQ(OB_SUCCESS, das_ref_.execute_all_task());
+  ASSERT_EQ(0, das_.sync_posts_.size());
+  // the task ops to the same server are sent by one rpc
+  ASSERT_EQ(2, das_.async_posts_.size());
+  ASSERT_EQ(svr1_, das_.async_posts_.at(0).first);
+  ASSERT_EQ(2, das_.async_posts_.at(0).second);
+  ASSERT_EQ(svr2_, das_.async_posts_.at(1).first);
+  ASSERT_EQ(1, das_.async_posts_.at(1).second);
+  check_all_task_decoded();
+}
+
+TEST_F(TestDASAsyncAccess, single_task_not_async)
+{
+  GCONF._enable_das_async_access.set_value("True");
+  ObDASTabletLoc loc1;
+  loc1.server_ = svr1_;
+  add_scan_task(loc1);
+  ASSERT_FALSE(das_ref_.need_async_access());
+  ASSERT_EQ(OB_SUCCESS, das_ref_.execute_all_task());
+  ASSERT_EQ(0, das_.async_posts_.size());
+  ASSERT_EQ(1, das_.sync_posts_.size());
+  check_all_task_decoded();
+}
+
+TEST_F(TestDASAsyncAccess, left_task_executed_alone)
+{
+  GCONF._enable_das_async_access.set_value("True");
+  // the response is full after the first task op of each rpc
+  das_.executed_limit_ = 1;
+  ObDASTabletLoc loc1;
+  ObDASTabletLoc loc2;
+  ObDASTabletLoc loc3;
+  loc1.server_ = svr1_;
+  loc2.server_ = svr1_;
+  loc3.server_ = svr2_;
+  add_scan_task(loc1);
+  add_scan_task(loc2);
+  add_scan_task(loc3);
+  ASSERT_EQ(OB_SUCCESS, das_ref_.execute_all_task());
+  ASSERT_EQ(2, das_.async_posts_.size());
+  ASSERT_EQ(svr1_, das_.async_posts_.at(0).first);
+  ASSERT_EQ(2, das_.async_posts_.at(0).second);
+  ASSERT_EQ(svr2_, das_.async_posts_.at(1).first);
+  ASSERT_EQ(1, das_.async_posts_.at(1).second);
+  // the task op left by the runner is sent again by itself
+  ASSERT_EQ(1, das_.sync_posts_.size());
+  ASSERT_EQ(svr1_, das_.sync_posts_.at(0).first);
+  ASSERT_EQ(1, das_.sync_posts_.at(0).second);
+  check_all_task_decoded();
+}
+
+TEST_F(TestDASAsyncAccess, coalesce_until_packet_full)
+{
+  const int64_t half_size = das::OB_DAS_MAX_PACKET_SIZE / 2;
+  ObSEArray<ObIDASTaskOp*, 4> task_ops;
+  ObDASTaskResp task_resp;
+  MockDASOp *op1 = add_mock_task(task_ops, task_resp, half_size);
+  MockDASOp *op2 = add_mock_task(task_ops, task_resp, half_size);
+  MockDASOp *op3 = add_mock_task(task_ops, task_resp, 100);
+  MockDASOp *op4 = add_mock_task(task_ops, task_resp, 100);
+  int64_t executed_cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, das_.execute_remote_task_ops(task_ops, task_resp, executed_cnt));
+  ASSERT_EQ(2, executed_cnt);
+  // each task op is given the budget left by the ones before it
+  ASSERT_EQ(das::OB_DAS_MAX_PACKET_SIZE, op1->memory_limit_);
+  ASSERT_EQ(das::OB_DAS_MAX_PACKET_SIZE - half_size, op2->memory_limit_);
+  ASSERT_FALSE(op3->is_executed());
+  ASSERT_FALSE(op4->is_executed());
+  ASSERT_TRUE(task_resp.is_op_executed(0));
+  ASSERT_TRUE(task_resp.is_op_executed(1));
+  ASSERT_FALSE(task_resp.is_op_executed(2));
+  ASSERT_FALSE(task_resp.is_op_executed(3));
+}
+
+TEST_F(TestDASAsyncAccess, result_exceeds_budget)
+{
+  ObSEArray<ObIDASTaskOp*, 4> task_ops;
+  ObDASTaskResp task_resp;
+  MockDASOp *op1 = add_mock_task(task_ops, task_resp, das::OB_DAS_MAX_PACKET_SIZE + 1024);
+  MockDASOp *op2 = add_mock_task(task_ops, task_resp, 100);
+  int64_t executed_cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, das_.execute_remote_task_ops(task_ops, task_resp, executed_cnt));
+  ASSERT_EQ(1, executed_cnt);
+  ASSERT_EQ(das::OB_DAS_MAX_PACKET_SIZE, op1->memory_limit_);
+  ASSERT_FALSE(op2->is_executed());
+  ASSERT_FALSE(task_resp.is_op_executed(1));
+}
+
+TEST_F(TestDASAsyncAccess, erase_results_on_failure)
+{
+  ObSEArray<ObIDASTaskOp*, 4> task_ops;
+  ObDASTaskResp task_resp;
+  MockDASOp *op1 = add_mock_task(task_ops, task_resp, 100);
+  MockDASOp *op2 = add_mock_task(task_ops, task_resp, 100);
+  MockDASOp *op3 = add_mock_task(task_ops, task_resp, 100);
+  MockDASOp *op4 = add_mock_task(task_ops, task_resp, 100);
+  op1->has_more_ = true;
+  op2->has_more_ = true;
+  op3->fill_ret_ = OB_ERR_UNEXPECTED;
+  int64_t executed_cnt = 0;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, das_.execute_remote_task_ops(task_ops, task_resp, executed_cnt));
+  ASSERT_EQ(3, executed_cnt);
+  ASSERT_FALSE(op4->is_executed());
+  DASTCBMap &tcb_map = das_.task_result_mgr_.tcb_map_;
+  ASSERT_EQ(OB_ENTRY_EXIST, tcb_map.contains_key(DASTCBInfo(op1->get_task_id())));
+  ASSERT_EQ(OB_ENTRY_EXIST, tcb_map.contains_key(DASTCBInfo(op2->get_task_id())));
+  // the controller drops the whole response, nobody fetches the extra results
+  das_.erase_remote_task_results(task_ops, executed_cnt);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, tcb_map.contains_key(DASTCBInfo(op1->get_task_id())));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, tcb_map.contains_key(DASTCBInfo(op2->get_task_id())));
+}
+
+}// namespace unittest
+}// namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_das_async_access.log");
+  oceanbase::common::ObLogger &logger = oceanbase::common::ObLogger::get_logger();
+  logger.set_file_name("test_das_async_access.log", false);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
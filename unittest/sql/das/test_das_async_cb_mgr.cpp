@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#define protected public
+#include "sql/das/ob_das_async_access.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/worker.h"
+
+namespace oceanbase {
+namespace unittest {
+
+using namespace common;
+using namespace sql;
+
+// the worker of a killed query
+class KilledWorker : public lib::Worker
+{
+public:
+  virtual int check_status() override { return OB_ERR_QUERY_INTERRUPTED; }
+};
+
+class TestDASAsyncCbMgr : public ::testing::Test
+{
+public:
+  TestDASAsyncCbMgr() : allocator_("TestDASAsync") {}
+  ~TestDASAsyncCbMgr() {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, cb_mgr_.init());
+  }
+  virtual void TearDown()
+  {
+    cb_mgr_.destroy();
+    allocator_.reset();
+  }
+  // the callbacks are allocated by das ref allocator and destructed by cb mgr
+  void add_cbs(const int64_t cb_cnt)
+  {
+    ObCurTraceId::TraceId trace_id;
+    trace_id.init(ObAddr(ObAddr::IPV4, "127.0.0.1", 2882));
+    for (int64_t i = 0; i < cb_cnt; ++i) {
+      void *buf = allocator_.alloc(sizeof(ObDASAsyncAccessCB));
+      ASSERT_TRUE(nullptr != buf);
+      ObDASAsyncAccessCB *cb = new (buf) ObDASAsyncAccessCB(cb_mgr_, trace_id);
+      ASSERT_EQ(OB_SUCCESS, cb_mgr_.add_cb(cb));
+    }
+  }
+  ObArenaAllocator allocator_;
+  ObDASAsyncCbMgr cb_mgr_;
+};
+
+TEST_F(TestDASAsyncCbMgr, wait_nothing)
+{
+  ASSERT_EQ(OB_SUCCESS, cb_mgr_.wait_all());
+  ASSERT_EQ(0, cb_mgr_.finished_cnt_);
+}
+
+TEST_F(TestDASAsyncCbMgr, finish_and_wait)
+{
+  add_cbs(3);
+  ObIArray<ObDASAsyncAccessCB*> &cb_list = cb_mgr_.get_cb_list();
+  for (int64_t i = 0; i < cb_list.count(); ++i) {
+    ASSERT_FALSE(cb_list.at(i)->is_finished());
+    ASSERT_EQ(OB_ERR_UNEXPECTED, cb_list.at(i)->get_rpc_ret());
+  }
+  // rpc threads finish the callbacks while the worker is waiting
+  std::thread rpc_thread([&]() {
+    ::usleep(50 * 1000);
+    cb_list.at(0)->process();
+    cb_list.at(1)->on_timeout();
+    ::usleep(50 * 1000);
+    cb_list.at(2)->on_invalid();
+  });
+  ASSERT_EQ(OB_SUCCESS, cb_mgr_.wait_all());
+  rpc_thread.join();
+  ASSERT_EQ(3, cb_mgr_.finished_cnt_);
+  for (int64_t i = 0; i < cb_list.count(); ++i) {
+    ASSERT_TRUE(cb_list.at(i)->is_finished());
+  }
+  ASSERT_EQ(OB_SUCCESS, cb_list.at(0)->get_rpc_ret());
+  ASSERT_EQ(OB_TIMEOUT, cb_list.at(1)->get_rpc_ret());
+  ASSERT_EQ(OB_RPC_PACKET_INVALID, cb_list.at(2)->get_rpc_ret());
+}
+
+TEST_F(TestDASAsyncCbMgr, rpc_error)
+{
+  add_cbs(1);
+  ObDASAsyncAccessCB *cb = cb_mgr_.get_cb_list().at(0);
+  cb->rcode_.rcode_ = OB_TENANT_NOT_IN_SERVER;
+  cb->process();
+  ASSERT_EQ(OB_SUCCESS, cb_mgr_.wait_all());
+  ASSERT_EQ(OB_TENANT_NOT_IN_SERVER, cb->get_rpc_ret());
+}
+
+TEST_F(TestDASAsyncCbMgr, interrupted)
+{
+  add_cbs(2);
+  ObIArray<ObDASAsyncAccessCB*> &cb_list = cb_mgr_.get_cb_list();
+  std::thread rpc_thread([&]() {
+    ::usleep(50 * 1000);
+    cb_list.at(0)->process();
+    ::usleep(50 * 1000);
+    cb_list.at(1)->process();
+  });
+  KilledWorker killed_worker;
+  lib::Worker *origin_worker = lib::Worker::self_;
+  lib::Worker::self_ = &killed_worker;
+  // the error is returned only after all in-flight callbacks finish
+  int ret = cb_mgr_.wait_all();
+  lib::Worker::self_ = origin_worker;
+  rpc_thread.join();
+  ASSERT_EQ(OB_ERR_QUERY_INTERRUPTED, ret);
+  ASSERT_EQ(2, cb_mgr_.finished_cnt_);
+  ASSERT_TRUE(cb_list.at(0)->is_finished());
+  ASSERT_TRUE(cb_list.at(1)->is_finished());
+}
+
+}// namespace unittest
+}// namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_das_async_cb_mgr.log");
+  oceanbase::common::ObLogger &logger = oceanbase::common::ObLogger::get_logger();
+  logger.set_file_name("test_das_async_cb_mgr.log", false);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include <gtest/gtest.h>
+#include "sql/engine/aggregate/ob_adaptive_bypass_ctrl.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestAdaptiveByPassCtrl : public ::testing::Test
+{
+public:
+  static const int64_t ROWS_PER_ROUND = 1000;
+  static const int64_t MAX_ROUNDS = 100;
+
+  TestAdaptiveByPassCtrl() = default;
+  virtual ~TestAdaptiveByPassCtrl() = default;
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // drive the controller the way ObHashGroupByOp does: fill the hash table until it
+  // leaves the cache, analyze the round, then either start by pass or restart a round.
+  // returns the round in which by pass starts.
+  int64_t rounds_before_by_pass(const int64_t exists_cnt_per_round)
+  {
+    ObAdaptiveByPassCtrl ctrl;
+    ctrl.open_by_pass_ctrl();
+    ctrl.set_small_row_cnt(ROWS_PER_ROUND);
+    int64_t round = 0;
+    while (!ctrl.by_passing() && round < MAX_ROUNDS) {
+      ++round;
+      ctrl.gby_process_state(ROWS_PER_ROUND, ROWS_PER_ROUND, 0);
+      EXPECT_EQ(ObAdaptiveByPassCtrl::STATE_ANALYZE, ctrl.state_);
+      for (int64_t i = 0; i < exists_cnt_per_round; ++i) {
+        ctrl.inc_exists_cnt();
+      }
+      ctrl.gby_process_state(ROWS_PER_ROUND, ROWS_PER_ROUND, 0);
+      EXPECT_TRUE(ctrl.processing_ht());
+      if (ctrl.rebuild_times_exceeded()) {
+        ctrl.start_by_pass();
+      } else {
+        ctrl.reset_state();
+        ctrl.inc_rebuild_times();
+      }
+    }
+    return round;
+  }
+
+private:
+  // disallow copy
+  TestAdaptiveByPassCtrl(const TestAdaptiveByPassCtrl &other);
+  TestAdaptiveByPassCtrl& operator=(const TestAdaptiveByPassCtrl &other);
+};
+
+TEST_F(TestAdaptiveByPassCtrl, no_duplicate)
+{
+  // 2 + 1 per round, exceeds MAX_REBUILD_TIMES after analyzing round 3
+  ASSERT_EQ(3, rounds_before_by_pass(0));
+}
+
+TEST_F(TestAdaptiveByPassCtrl, half_of_threshold)
+{
+  // reduction 1/3 against threshold 2/3 of INIT_CUT_RATIO adds 1 + 1 per round
+  ASSERT_EQ(4, rounds_before_by_pass(ROWS_PER_ROUND / 3));
+}
+
+TEST_F(TestAdaptiveByPassCtrl, close_to_threshold)
+{
+  // reduction 0.6 adds nothing, only the restarted rounds are counted
+  ASSERT_EQ(MAX_REBUILD_TIMES + 2, rounds_before_by_pass(ROWS_PER_ROUND * 6 / 10));
+}
+
+TEST_F(TestAdaptiveByPassCtrl, good_reduction_never_by_pass)
+{
+  ASSERT_EQ(MAX_ROUNDS, rounds_before_by_pass(ROWS_PER_ROUND * 7 / 10));
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_adaptive_bypass_ctrl.log*");
+  OB_LOGGER.set_file_name("test_adaptive_bypass_ctrl.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -305,6 +305,69 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, special_char_finder)
+{
+  ObCSVSpecialCharFinder finder;
+  finder.add_char(',');
+  finder.add_char('\n');
+  finder.add_char(INT64_MAX);
+  char buf[256];
+  for (int64_t i = 0; i < sizeof(buf); ++i) {
+    buf[i] = static_cast<char>('a' + i % 26);
+  }
+  const char *end = buf + sizeof(buf);
+  ASSERT_EQ(end, finder.find(buf, end));
+  // every position is found, across the vector steps and the scalar tail
+  for (int64_t pos = 0; pos < sizeof(buf); ++pos) {
+    buf[pos] = (pos % 2 == 0) ? ',' : '\n';
+    for (int64_t start = 0; start <= pos; start += 7) {
+      ASSERT_EQ(buf + pos, finder.find(buf + start, end));
+    }
+    ASSERT_EQ(end, finder.find(buf + pos + 1, end));
+    buf[pos] = 'x';
+  }
+  // non-ascii bytes stop the scan only for multi-byte charsets
+  buf[100] = static_cast<char>(0xC4);
+  ASSERT_EQ(end, finder.find(buf, end));
+  finder.set_stop_at_non_ascii(true);
+  ASSERT_EQ(buf + 100, finder.find(buf, end));
+}
+
+TEST_F(TestParser, general_parser_in_memory)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+  ObCSVGeneralParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, 3, CS_TYPE_UTF8MB4_BIN));
+
+  const char *data = "abcdefghijklmnopqrstuvwxyz0123456789,\"quoted, with \"\"comma\"\",\xE4\xB8\xAD\xE6\x96\x87\n"
+                     "1,2,3\n";
+  const char *ptr = data;
+  const char *end = data + strlen(data);
+  int64_t nrows = INT64_MAX;
+  char escape_buf[256];
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 4> errors;
+  ObSEArray<ObString, 8> values;
+  auto collect = [&values](ObIArray<ObCSVGeneralParser::FieldValue> &fields) -> int {
+    int ret = OB_SUCCESS;
+    for (int64_t i = 0; OB_SUCC(ret) && i < fields.count(); ++i) {
+      ret = values.push_back(ObString(fields.at(i).len_, fields.at(i).ptr_));
+    }
+    return ret;
+  };
+  ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(collect), true>(ptr, end, nrows,
+                         escape_buf, escape_buf + sizeof(escape_buf), collect, errors, false)));
+  ASSERT_EQ(2, nrows);
+  ASSERT_EQ(0, errors.count());
+  ASSERT_EQ(6, values.count());
+  ASSERT_EQ(ObString("abcdefghijklmnopqrstuvwxyz0123456789"), values.at(0));
+  ASSERT_EQ(ObString("quoted, with \"comma\""), values.at(1));
+  ASSERT_EQ(ObString("\xE4\xB8\xAD\xE6\x96\x87"), values.at(2));
+  ASSERT_EQ(ObString("3"), values.at(5));
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
@@ -0,0 +1,277 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+#include "sql/engine/px/ob_granule_util.h"
+#include "sql/das/ob_das_define.h"
+#include "storage/tx_storage/ob_access_service.h"
+#include "share/rc/ob_tenant_base.h"
+#include "lib/allocator/page_arena.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+using namespace oceanbase::storage;
+using namespace oceanbase::share;
+
+static const int64_t TEST_TABLE_ID = 1;
+static const int64_t MB = 1024 * 1024;
+
+// [start, end) ranges of a single integer rowkey column
+typedef std::pair<int64_t, int64_t> IntRange;
+
+static int make_range(ObIAllocator &allocator, const int64_t start, const int64_t end,
+                      ObNewRange &range)
+{
+  int ret = OB_SUCCESS;
+  ObObj *objs = NULL;
+  if (OB_ISNULL(objs = static_cast<ObObj *>(allocator.alloc(sizeof(ObObj) * 2)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    objs[0].set_int(start);
+    objs[1].set_int(end);
+    range.table_id_ = TEST_TABLE_ID;
+    range.start_key_.assign(&objs[0], 1);
+    range.end_key_.assign(&objs[1], 1);
+    range.border_flag_.set_inclusive_start();
+    range.border_flag_.unset_inclusive_end();
+  }
+  return ret;
+}
+
+// data size of each tablet is given by the test, splitting cuts the input ranges into
+// pieces of the same width in order, like the index block tree does with even blocks
+class MockAccessService : public ObAccessService
+{
+public:
+  MockAccessService() : allocator_("TestGranule") {}
+  virtual int get_multi_ranges_cost(
+      const ObLSID &ls_id,
+      const ObTabletID &tablet_id,
+      const ObIArray<ObStoreRange> &ranges,
+      int64_t &total_size) override
+  {
+    UNUSED(ls_id);
+    UNUSED(ranges);
+    total_size = tablet_sizes_.at(tablet_id.id() - 1);
+    return OB_SUCCESS;
+  }
+  virtual int split_multi_ranges(
+      const ObLSID &ls_id,
+      const ObTabletID &tablet_id,
+      const ObIArray<ObStoreRange> &ranges,
+      const int64_t expected_task_count,
+      ObIAllocator &allocator,
+      ObArrayArray<ObStoreRange> &multi_range_split_array) override
+  {
+    UNUSED(ls_id);
+    UNUSED(tablet_id);
+    UNUSED(allocator);
+    int ret = OB_SUCCESS;
+    int64_t total_width = 0;
+    for (int64_t i = 0; i < ranges.count(); ++i) {
+      total_width += get_int(ranges.at(i).get_end_key()) - get_int(ranges.at(i).get_start_key());
+    }
+    const int64_t task_width = std::max(1L, (total_width + expected_task_count - 1) / expected_task_count);
+    ObSEArray<ObStoreRange, 4> task_ranges;
+    int64_t width = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < ranges.count(); ++i) {
+      int64_t start = get_int(ranges.at(i).get_start_key());
+      const int64_t end = get_int(ranges.at(i).get_end_key());
+      while (OB_SUCC(ret) && start < end) {
+        const int64_t piece = std::min(end - start, task_width - width);
+        ObNewRange new_range;
+        ObStoreRange store_range;
+        if (OB_FAIL(make_range(allocator_, start, start + piece, new_range))) {
+        } else if (FALSE_IT(store_range.assign(new_range))) {
+        } else if (OB_FAIL(task_ranges.push_back(store_range))) {
+        } else {
+          start += piece;
+          width += piece;
+          if (task_width == width) {
+            ret = multi_range_split_array.push_back(task_ranges);
+            task_ranges.reuse();
+            width = 0;
+          }
+        }
+      }
+    }
+    if (OB_SUCC(ret) && !task_ranges.empty()) {
+      ret = multi_range_split_array.push_back(task_ranges);
+    }
+    return ret;
+  }
+  static int64_t get_int(const ObStoreRowkey &rowkey) { return rowkey.get_obj_ptr()[0].get_int(); }
+
+  ObArenaAllocator allocator_;
+  std::vector<int64_t> tablet_sizes_;
+};
+
+class TestGranuleUtil : public ::testing::Test
+{
+public:
+  static const int64_t MAX_TABLET_CNT = 4;
+
+  TestGranuleUtil() : allocator_("TestGranule"), tenant_base_(1), tablet_cnt_(0) {}
+  virtual ~TestGranuleUtil() = default;
+  virtual void SetUp()
+  {
+    ObAccessService *access_service = &access_service_;
+    tenant_base_.set(access_service);
+    ObTenantEnv::set_tenant(&tenant_base_);
+  }
+  virtual void TearDown()
+  {
+    allocator_.reset();
+  }
+
+  // tablet i + 1 holds tablet_sizes[i] MB
+  void split(const std::vector<IntRange> &input,
+             const std::vector<int64_t> &tablet_sizes,
+             const int64_t parallelism)
+  {
+    ObSEArray<ObNewRange, 4> ranges;
+    for (int64_t i = 0; i < static_cast<int64_t>(input.size()); ++i) {
+      ObNewRange range;
+      ASSERT_EQ(OB_SUCCESS, make_range(allocator_, input.at(i).first, input.at(i).second, range));
+      ASSERT_EQ(OB_SUCCESS, ranges.push_back(range));
+    }
+    access_service_.tablet_sizes_.clear();
+    tablet_ptrs_.reset();
+    tablet_cnt_ = tablet_sizes.size();
+    ASSERT_LE(tablet_cnt_, MAX_TABLET_CNT);
+    for (int64_t i = 0; i < tablet_cnt_; ++i) {
+      access_service_.tablet_sizes_.push_back(tablet_sizes.at(i) * MB);
+      tablets_[i].tablet_id_ = ObTabletID(i + 1);
+      tablets_[i].ls_id_ = ObLSID(1001);
+      ASSERT_EQ(OB_SUCCESS, tablet_ptrs_.push_back(&tablets_[i]));
+    }
+    granule_tablets_.reset();
+    granule_ranges_.reset();
+    granule_idx_.reset();
+    ASSERT_EQ(OB_SUCCESS, ObGranuleUtil::split_block_ranges(allocator_,
+                                                            NULL,
+                                                            ranges,
+                                                            tablet_ptrs_,
+                                                            parallelism,
+                                                            OB_DEFAULT_TABLET_SIZE,
+                                                            false,
+                                                            granule_tablets_,
+                                                            granule_ranges_,
+                                                            granule_idx_,
+                                                            false));
+    ASSERT_EQ(granule_ranges_.count(), granule_tablets_.count());
+    ASSERT_EQ(granule_ranges_.count(), granule_idx_.count());
+  }
+
+  // the granules of each tablet are disjoint, kept in order and cover the input exactly
+  void check_cover(const std::vector<IntRange> &input)
+  {
+    int64_t g = 0;
+    for (int64_t t = 0; t < tablet_cnt_; ++t) {
+      std::vector<IntRange> merged;
+      for (; g < granule_ranges_.count() && granule_tablets_.at(g) == &tablets_[t]; ++g) {
+        const ObNewRange &range = granule_ranges_.at(g);
+        ASSERT_TRUE(range.border_flag_.inclusive_start());
+        ASSERT_FALSE(range.border_flag_.inclusive_end());
+        const int64_t start = range.start_key_.get_obj_ptr()[0].get_int();
+        const int64_t end = range.end_key_.get_obj_ptr()[0].get_int();
+        ASSERT_LT(start, end);
+        if (!merged.empty()) {
+          ASSERT_GE(start, merged.back().second);
+        }
+        if (!merged.empty() && start == merged.back().second) {
+          merged.back().second = end;
+        } else {
+          merged.push_back(IntRange(start, end));
+        }
+      }
+      ASSERT_EQ(input, merged);
+    }
+    ASSERT_EQ(granule_ranges_.count(), g);
+  }
+
+  int64_t granule_width(const int64_t idx)
+  {
+    const ObNewRange &range = granule_ranges_.at(idx);
+    return range.end_key_.get_obj_ptr()[0].get_int() - range.start_key_.get_obj_ptr()[0].get_int();
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObTenantBase tenant_base_;
+  MockAccessService access_service_;
+  ObDASTabletLoc tablets_[MAX_TABLET_CNT];
+  int64_t tablet_cnt_;
+  ObSEArray<ObDASTabletLoc *, 4> tablet_ptrs_;
+  ObSEArray<ObDASTabletLoc *, 64> granule_tablets_;
+  ObSEArray<ObNewRange, 64> granule_ranges_;
+  ObSEArray<int64_t, 64> granule_idx_;
+
+private:
+  // disallow copy
+  TestGranuleUtil(const TestGranuleUtil &other);
+  TestGranuleUtil& operator=(const TestGranuleUtil &other);
+};
+
+TEST_F(TestGranuleUtil, split_tail_tasks)
+{
+  // 1280MB with dop 4 gives 52 tasks, the last min(4, 52 * 10%) = 4 ones are split again
+  std::vector<IntRange> input = { IntRange(0, 5200), IntRange(6000, 11200) };
+  split(input, { 1280 }, 4);
+  check_cover(input);
+  ASSERT_EQ(48 + 4 * ObGranuleUtil::TAIL_TASK_SPLIT_CNT, granule_ranges_.count());
+  ASSERT_EQ(200, granule_width(0));
+  ASSERT_EQ(200, granule_width(47));
+  ASSERT_EQ(50, granule_width(48));
+  ASSERT_EQ(50, granule_width(granule_ranges_.count() - 1));
+}
+
+TEST_F(TestGranuleUtil, split_tail_tasks_across_tablets)
+{
+  // 51 tasks for the first tablet and 1 for the second one, the 4 tail tasks are the last
+  // 3 ones of the first tablet and the only task of the second tablet
+  std::vector<IntRange> input = { IntRange(0, 5100) };
+  split(input, { 1260, 20 }, 4);
+  check_cover(input);
+  ASSERT_EQ(48 + 3 * ObGranuleUtil::TAIL_TASK_SPLIT_CNT + ObGranuleUtil::TAIL_TASK_SPLIT_CNT,
+            granule_ranges_.count());
+  ASSERT_EQ(&tablets_[1], granule_tablets_.at(granule_ranges_.count() - 1));
+  ASSERT_EQ(1275, granule_width(granule_ranges_.count() - 1));
+}
+
+TEST_F(TestGranuleUtil, fewer_tasks_than_dop)
+{
+  // 30MB with dop 64 gives 15 tasks, only min(64, 15 * 10%) = 1 tail task is split
+  std::vector<IntRange> input = { IntRange(0, 1500) };
+  split(input, { 30 }, 64);
+  check_cover(input);
+  ASSERT_EQ(14 + ObGranuleUtil::TAIL_TASK_SPLIT_CNT, granule_ranges_.count());
+  ASSERT_LT(granule_ranges_.count(), 64);
+
+  // too few tasks to have a tail, nothing is split again
+  split(input, { 10 }, 64);
+  check_cover(input);
+  ASSERT_EQ(5, granule_ranges_.count());
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_granule_util.log*");
+  OB_LOGGER.set_file_name("test_granule_util.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#define protected public
+#include "sql/engine/px/ob_px_bloom_filter.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+#undef private
+#undef protected
+#include "lib/hash_func/murmur_hash.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestPxBloomFilter : public ::testing::Test
+{
+public:
+  static const int64_t THREAD_COUNT = 8;
+
+  TestPxBloomFilter() : allocator_(ObModIds::TEST) {}
+  virtual ~TestPxBloomFilter() = default;
+  virtual void SetUp() {}
+  virtual void TearDown() { allocator_.reset(); }
+
+  // the join key datum of the build or probe side, NULL if is_null
+  struct Key
+  {
+    Key(const int64_t v, const bool is_null) : val_(v)
+    {
+      datum_.ptr_ = reinterpret_cast<const char *>(&val_);
+      if (is_null) {
+        datum_.set_null();
+      } else {
+        datum_.set_int(v);
+      }
+    }
+    int64_t val_;
+    ObDatum datum_;
+  };
+
+  static uint64_t hash_key(const ObDatum &datum)
+  {
+    uint64_t hash = ObExprJoinFilter::JOIN_FILTER_SEED;
+    if (datum.is_null()) {
+      hash = murmurhash(&hash, sizeof(hash), hash);
+    } else {
+      const int64_t v = datum.get_int();
+      hash = murmurhash(&v, sizeof(v), hash);
+    }
+    return hash;
+  }
+
+  static uint64_t hash_int(const int64_t v)
+  {
+    Key key(v, false);
+    return hash_key(key.datum_);
+  }
+
+  // same as ObJoinFilterOp::insert_by_row, NULL keys go to the bloom filter and in-list only
+  static void build(ObPxBloomFilter &filter, const Key &key)
+  {
+    ASSERT_EQ(OB_SUCCESS, filter.put(hash_key(key.datum_)));
+    if (filter.has_range() && !key.datum_.is_null()) {
+      filter.put_range(key.datum_.get_int());
+    }
+  }
+
+  static bool probe(ObExprJoinFilter::ObExprJoinFilterContext &ctx, const Key &key)
+  {
+    bool is_match = false;
+    EXPECT_EQ(OB_SUCCESS, ObExprJoinFilter::check_contain(ctx, &key.datum_,
+                                                          hash_key(key.datum_), is_match));
+    return is_match;
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+
+private:
+  // disallow copy
+  TestPxBloomFilter(const TestPxBloomFilter &other);
+  TestPxBloomFilter& operator=(const TestPxBloomFilter &other);
+};
+
+TEST_F(TestPxBloomFilter, concurrent_put_in_list)
+{
+  const int64_t key_cnt = 1000;
+  ObPxBloomFilter filter;
+  ASSERT_EQ(OB_SUCCESS, filter.init(key_cnt, allocator_));
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < THREAD_COUNT; ++t) {
+    // every worker puts all keys from a different start, so that they race on the same slots
+    threads.push_back(std::thread([&filter, t, key_cnt]() {
+      for (int64_t i = 0; i < key_cnt; ++i) {
+        ASSERT_EQ(OB_SUCCESS, filter.put(hash_int((i + t * key_cnt / THREAD_COUNT) % key_cnt)));
+      }
+    }));
+  }
+  for (int64_t t = 0; t < THREAD_COUNT; ++t) {
+    threads.at(t).join();
+  }
+  ASSERT_TRUE(filter.is_in_list_valid());
+  ASSERT_EQ(key_cnt, filter.in_list_count_);
+  int64_t slot_cnt = 0;
+  for (int64_t i = 0; i < filter.in_list_capacity_; ++i) {
+    slot_cnt += (0 != filter.in_list_slots_[i]);
+  }
+  ASSERT_EQ(key_cnt, slot_cnt);
+  for (int64_t i = 0; i < key_cnt; ++i) {
+    ASSERT_TRUE(filter.in_list_contain(hash_int(i)));
+  }
+  // no false positive
+  for (int64_t i = key_cnt; i < key_cnt * 10; ++i) {
+    ASSERT_FALSE(filter.in_list_contain(hash_int(i)));
+  }
+}
+
+TEST_F(TestPxBloomFilter, in_list_overflow)
+{
+  const int64_t max_cnt = ObPxBloomFilter::MAX_IN_LIST_COUNT;
+  ObPxBloomFilter filter;
+  ASSERT_EQ(OB_SUCCESS, filter.init(max_cnt * 2, allocator_));
+  for (int64_t i = 0; i < max_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, filter.put(hash_int(i)));
+    // duplicated keys are not counted
+    ASSERT_EQ(OB_SUCCESS, filter.put(hash_int(i)));
+  }
+  ASSERT_TRUE(filter.is_in_list_valid());
+  ASSERT_EQ(max_cnt, filter.in_list_count_);
+
+  // one more distinct key falls back to the plain bloom filter
+  ASSERT_EQ(OB_SUCCESS, filter.put(hash_int(max_cnt)));
+  ASSERT_FALSE(filter.is_in_list_valid());
+  ObExprJoinFilter::ObExprJoinFilterContext ctx;
+  ctx.bloom_filter_ptr_ = &filter;
+  for (int64_t i = 0; i <= max_cnt; ++i) {
+    Key key(i, false);
+    ASSERT_TRUE(probe(ctx, key));
+  }
+  ASSERT_EQ(0, ctx.in_filter_count_);
+  ASSERT_EQ(0, ctx.range_filter_count_);
+
+  // a sender without in-list disables the in-list of the receiver
+  ObPxBloomFilter receiver;
+  ASSERT_EQ(OB_SUCCESS, receiver.init(max_cnt * 2, allocator_));
+  ASSERT_EQ(OB_SUCCESS, receiver.put(hash_int(0)));
+  ASSERT_TRUE(receiver.is_in_list_valid());
+  ASSERT_EQ(OB_SUCCESS, receiver.merge_filter(&filter));
+  ASSERT_FALSE(receiver.is_in_list_valid());
+  bool is_match = false;
+  for (int64_t i = 0; i <= max_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, receiver.might_contain(hash_int(i), is_match));
+    ASSERT_TRUE(is_match);
+  }
+}
+
+TEST_F(TestPxBloomFilter, range_with_null)
+{
+  ObPxBloomFilter filter;
+  ASSERT_EQ(OB_SUCCESS, filter.init(100, allocator_));
+  filter.enable_range();
+  build(filter, Key(10, false));
+  build(filter, Key(20, false));
+  build(filter, Key(0, true));
+  build(filter, Key(30, false));
+  // NULL does not widen the range
+  ASSERT_EQ(10, filter.min_val_);
+  ASSERT_EQ(30, filter.max_val_);
+
+  ObExprJoinFilter::ObExprJoinFilterContext ctx;
+  ctx.bloom_filter_ptr_ = &filter;
+  ASSERT_FALSE(probe(ctx, Key(5, false)));
+  ASSERT_FALSE(probe(ctx, Key(31, false)));
+  ASSERT_EQ(2, ctx.range_filter_count_);
+  ASSERT_TRUE(probe(ctx, Key(10, false)));
+  ASSERT_TRUE(probe(ctx, Key(30, false)));
+  // inside the range, rejected by the in-list
+  ASSERT_FALSE(probe(ctx, Key(15, false)));
+  ASSERT_EQ(1, ctx.in_filter_count_);
+  // a NULL probe key skips the range and is checked by the in-list
+  ASSERT_TRUE(probe(ctx, Key(0, true)));
+  ASSERT_EQ(2, ctx.range_filter_count_);
+
+  // a build side of NULLs only prunes every non NULL probe key by range
+  ObPxBloomFilter null_filter;
+  ASSERT_EQ(OB_SUCCESS, null_filter.init(100, allocator_));
+  null_filter.enable_range();
+  build(null_filter, Key(0, true));
+  ObExprJoinFilter::ObExprJoinFilterContext null_ctx;
+  null_ctx.bloom_filter_ptr_ = &null_filter;
+  ASSERT_FALSE(probe(null_ctx, Key(0, false)));
+  ASSERT_FALSE(probe(null_ctx, Key(INT64_MIN, false)));
+  ASSERT_FALSE(probe(null_ctx, Key(INT64_MAX, false)));
+  ASSERT_TRUE(probe(null_ctx, Key(0, true)));
+
+  // merging widens the range, a range of NULLs only changes nothing
+  ObPxBloomFilter other;
+  ASSERT_EQ(OB_SUCCESS, other.init(100, allocator_));
+  other.enable_range();
+  build(other, Key(-5, false));
+  ASSERT_EQ(OB_SUCCESS, filter.merge_filter(&other));
+  ASSERT_EQ(OB_SUCCESS, filter.merge_filter(&null_filter));
+  ASSERT_EQ(-5, filter.min_val_);
+  ASSERT_EQ(30, filter.max_val_);
+  ASSERT_TRUE(probe(ctx, Key(-5, false)));
+  ASSERT_FALSE(probe(ctx, Key(-6, false)));
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_px_bloom_filter.log*");
+  OB_LOGGER.set_file_name("test_px_bloom_filter.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
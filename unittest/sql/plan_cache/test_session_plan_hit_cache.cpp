@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "sql/plan_cache/ob_session_plan_hit_cache.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestSessionPlanHitCache : public ::testing::Test
+{
+public:
+  TestSessionPlanHitCache()
+    : allocator_("SessPlanHitUT"), params_((ObWrapperAllocator(&allocator_))) {}
+  virtual ~TestSessionPlanHitCache() {}
+  virtual void SetUp()
+  {
+    stamp_.tenant_schema_version_ = 100;
+    stamp_.session_state_hash_ = 200;
+    stamp_.enable_role_hash_ = 0;
+    pc_key_.name_ = ObString::make_string("select * from t1 where c1 = ?");
+    pc_key_.db_id_ = 500001;
+    pc_key_.sys_vars_str_ = ObString::make_string("sys_vars");
+    pc_key_.config_str_ = ObString::make_string("configs");
+    pc_key_.namespace_ = NS_CRSR;
+    ObObjParam int_param;
+    int_param.set_int(1);
+    ObObjParam str_param;
+    str_param.set_varchar("abc");
+    str_param.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    ASSERT_EQ(OB_SUCCESS, params_.push_back(int_param));
+    ASSERT_EQ(OB_SUCCESS, params_.push_back(str_param));
+  }
+  virtual void TearDown()
+  {
+    cache_.reset();
+    params_.reset();
+  }
+  int put(const char *sql, const ObCacheObjID plan_id, const int64_t capacity = 8)
+  {
+    return cache_.put(TENANT_ID, capacity, ObString::make_string(sql), stamp_, plan_id,
+                      pc_key_, traits_, params_);
+  }
+  static const uint64_t TENANT_ID = 1001;
+  ObArenaAllocator allocator_;
+  ObSessionPlanHitCache cache_;
+  ObPlanHitStamp stamp_;
+  ObPlanCacheKey pc_key_;
+  ObSqlTraits traits_;
+  ParamStore params_;
+};
+
+TEST_F(TestSessionPlanHitCache, get_and_put)
+{
+  const char *sql = "select * from t1 where c1 = 1 and c2 = 'abc'";
+  const ObSessionPlanHitCache::Entry *entry = NULL;
+  ASSERT_TRUE(NULL == cache_.get(ObString::make_string(sql), stamp_));
+  ASSERT_EQ(OB_SUCCESS, put(sql, 10));
+  ASSERT_EQ(1, cache_.count());
+  ASSERT_TRUE(NULL != (entry = cache_.get(ObString::make_string(sql), stamp_)));
+  EXPECT_EQ(10, entry->plan_id_);
+  EXPECT_TRUE(entry->raw_sql_ == ObString::make_string(sql));
+  EXPECT_TRUE(entry->pc_key_.is_equal(pc_key_));
+  EXPECT_EQ(pc_key_.hash(), entry->pc_key_.hash());
+  // params are deep copied into the entry
+  ASSERT_EQ(2, entry->param_count_);
+  EXPECT_EQ(1, entry->params_[0].get_int());
+  EXPECT_TRUE(entry->params_[1].get_string() == ObString::make_string("abc"));
+  EXPECT_NE(params_.at(1).get_string().ptr(), entry->params_[1].get_string().ptr());
+  // text differs, not remembered
+  ASSERT_TRUE(NULL == cache_.get(ObString::make_string("select * from t1 where c1 = 2"), stamp_));
+
+  // put the same text again replaces the old entry
+  ASSERT_EQ(OB_SUCCESS, put(sql, 11));
+  ASSERT_EQ(1, cache_.count());
+  ASSERT_TRUE(NULL != (entry = cache_.get(ObString::make_string(sql), stamp_)));
+  EXPECT_EQ(11, entry->plan_id_);
+
+  cache_.remove(ObString::make_string(sql));
+  ASSERT_EQ(0, cache_.count());
+}
+
+TEST_F(TestSessionPlanHitCache, stale_stamp)
+{
+  const char *sql = "select * from t1 where c1 = 1";
+  ObPlanHitStamp new_stamp = stamp_;
+  // schema version pushed up by ddl
+  new_stamp.tenant_schema_version_ += 1;
+  ASSERT_EQ(OB_SUCCESS, put(sql, 10));
+  ASSERT_TRUE(NULL == cache_.get(ObString::make_string(sql), new_stamp));
+  ASSERT_EQ(0, cache_.count());
+  // session state changed
+  ASSERT_EQ(OB_SUCCESS, put(sql, 10));
+  new_stamp = stamp_;
+  new_stamp.session_state_hash_ += 1;
+  ASSERT_TRUE(NULL == cache_.get(ObString::make_string(sql), new_stamp));
+  ASSERT_EQ(0, cache_.count());
+  // enabled roles changed
+  ASSERT_EQ(OB_SUCCESS, put(sql, 10));
+  new_stamp = stamp_;
+  new_stamp.enable_role_hash_ = 12345;
+  ASSERT_TRUE(NULL == cache_.get(ObString::make_string(sql), new_stamp));
+  ASSERT_EQ(0, cache_.count());
+  // same stamp still hits
+  ASSERT_EQ(OB_SUCCESS, put(sql, 10));
+  ASSERT_TRUE(NULL != cache_.get(ObString::make_string(sql), stamp_));
+}
+
+TEST_F(TestSessionPlanHitCache, evict_lru)
+{
+  const int64_t capacity = 3;
+  ASSERT_EQ(OB_SUCCESS, put("select 1", 1, capacity));
+  ASSERT_EQ(OB_SUCCESS, put("select 2", 2, capacity));
+  ASSERT_EQ(OB_SUCCESS, put("select 3", 3, capacity));
+  ASSERT_EQ(3, cache_.count());
+  // touch the oldest one, "select 2" becomes the least recently used
+  ASSERT_TRUE(NULL != cache_.get(ObString::make_string("select 1"), stamp_));
+  ASSERT_EQ(OB_SUCCESS, put("select 4", 4, capacity));
+  ASSERT_EQ(3, cache_.count());
+  EXPECT_TRUE(NULL == cache_.get(ObString::make_string("select 2"), stamp_));
+  EXPECT_TRUE(NULL != cache_.get(ObString::make_string("select 1"), stamp_));
+  EXPECT_TRUE(NULL != cache_.get(ObString::make_string("select 3"), stamp_));
+  EXPECT_TRUE(NULL != cache_.get(ObString::make_string("select 4"), stamp_));
+
+  // capacity shrinks, extra entries are evicted on next put
+  ASSERT_EQ(OB_SUCCESS, put("select 5", 5, 1));
+  ASSERT_EQ(1, cache_.count());
+  EXPECT_TRUE(NULL != cache_.get(ObString::make_string("select 5"), stamp_));
+
+  // disabled
+  ASSERT_EQ(OB_SUCCESS, put("select 6", 6, 0));
+  EXPECT_TRUE(NULL == cache_.get(ObString::make_string("select 6"), stamp_));
+}
+
+TEST_F(TestSessionPlanHitCache, skip_big_entry_and_switch_tenant)
+{
+  char big_sql[ObSessionPlanHitCache::MAX_ENTRY_MEM_SIZE];
+  MEMSET(big_sql, 'a', sizeof(big_sql));
+  big_sql[sizeof(big_sql) - 1] = '\0';
+  ASSERT_EQ(OB_SUCCESS, put(big_sql, 1));
+  ASSERT_EQ(0, cache_.count());
+
+  ASSERT_EQ(OB_SUCCESS, put("select 1", 1));
+  ASSERT_EQ(1, cache_.count());
+  // entries of the previous tenant are dropped
+  ASSERT_EQ(OB_SUCCESS, cache_.put(TENANT_ID + 1, 8, ObString::make_string("select 2"), stamp_, 2,
+                                   pc_key_, traits_, params_));
+  ASSERT_EQ(1, cache_.count());
+  EXPECT_TRUE(NULL == cache_.get(ObString::make_string("select 1"), stamp_));
+  EXPECT_TRUE(NULL != cache_.get(ObString::make_string("select 2"), stamp_));
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_session_plan_hit_cache.log");
+  OB_LOGGER.set_file_name("test_session_plan_hit_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_gts_source.h"
+#undef private
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/net/ob_addr.h"
+#include "share/config/ob_server_config.h"
+#include "storage/tx/ob_gts_rpc.h"
+#include "storage/tx/ob_gts_define.h"
+#include "storage/tx/ob_location_adapter.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace transaction;
+namespace unittest
+{
+
+class MyGtsRequestRpc : public ObIGtsRequestRpc
+{
+public:
+  MyGtsRequestRpc() : post_cnt_(0) {}
+  ~MyGtsRequestRpc() {}
+  int start() { return OB_SUCCESS; }
+  int stop() { return OB_SUCCESS; }
+  int wait() { return OB_SUCCESS; }
+  void destroy() {}
+  int post(const uint64_t tenant_id, const ObAddr &server, const ObGtsRequest &msg)
+  {
+    UNUSED(tenant_id);
+    UNUSED(server);
+    UNUSED(msg);
+    ++post_cnt_;
+    return OB_SUCCESS;
+  }
+  int64_t post_cnt_;
+};
+
+// the gts leader is always a remote server, so every cache miss goes to rpc
+class MyLocationAdapter : public ObILocationAdapter
+{
+public:
+  explicit MyLocationAdapter(const ObAddr &leader) : leader_(leader) {}
+  ~MyLocationAdapter() {}
+  int init(share::schema::ObMultiVersionSchemaService *schema_service,
+           share::ObLocationService *location_service)
+  {
+    UNUSED(schema_service);
+    UNUSED(location_service);
+    return OB_SUCCESS;
+  }
+  void destroy() {}
+  int nonblock_get_leader(const int64_t cluster_id, const int64_t tenant_id,
+                          const ObLSID &ls_id, ObAddr &leader)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    leader = leader_;
+    return OB_SUCCESS;
+  }
+  int nonblock_renew(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int nonblock_get(const int64_t cluster_id, const int64_t tenant_id,
+                   const ObLSID &ls_id, ObLSLocation &location)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    UNUSED(location);
+    return OB_NOT_SUPPORTED;
+  }
+private:
+  ObAddr leader_;
+};
+
+class TestObGtsLease : public ::testing::Test
+{
+public:
+  static const uint64_t TENANT_ID = 1001;
+  static const int64_t NS_PER_US = 1000;
+
+  TestObGtsLease()
+    : self_(ObAddr::IPV4, "10.0.0.1", 20000),
+      leader_(ObAddr::IPV4, "10.0.0.2", 20000),
+      location_adapter_(leader_) {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, gts_source_.init(TENANT_ID, self_, &rpc_, &location_adapter_));
+  }
+  virtual void TearDown()
+  {
+    gts_source_.destroy();
+    GCONF._gts_lease_time.set_value("0ms");
+    GCONF._gts_clock_uncertainty.set_value("1ms");
+  }
+  // the response of the gts leader to a request sent at srr, see ObTimestampService::handle_request
+  void receive_gts(const MonotonicTs srr, int64_t &gts)
+  {
+    bool update = false;
+    gts = ObTimeUtility::current_time_ns() + get_gts_clock_uncertainty_ns();
+    const int64_t gts_end = is_gts_lease_enabled() ? gts + get_gts_lease_time_us() * NS_PER_US : gts;
+    ASSERT_EQ(OB_SUCCESS, gts_source_.update_gts(srr, gts, gts_end, srr, update));
+  }
+protected:
+  ObAddr self_;
+  ObAddr leader_;
+  MyGtsRequestRpc rpc_;
+  MyLocationAdapter location_adapter_;
+  ObGtsSource gts_source_;
+};
+
+TEST_F(TestObGtsLease, lease_disabled)
+{
+  int64_t gts = 0;
+  receive_gts(MonotonicTs::current_time(), gts);
+  ob_usleep(1000);
+  int64_t new_gts = 0;
+  MonotonicTs receive_gts_ts;
+  // the cached gts is older than stc, ask the leader
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(MonotonicTs::current_time(), NULL, new_gts, receive_gts_ts));
+  EXPECT_EQ(1, rpc_.post_cnt_);
+  EXPECT_EQ(0, ATOMIC_LOAD(&gts_source_.gts_statistics_.get_gts_by_lease_cnt_));
+}
+
+TEST_F(TestObGtsLease, lease_hit)
+{
+  GCONF._gts_lease_time.set_value("1s");
+  int64_t gts = 0;
+  receive_gts(MonotonicTs::current_time(), gts);
+  ob_usleep(1000);
+  int64_t last_gts = gts;
+  for (int64_t i = 0; i < 10; ++i) {
+    const int64_t now_ns = ObTimeUtility::current_time_ns();
+    int64_t lease_gts = 0;
+    MonotonicTs receive_gts_ts;
+    ASSERT_EQ(OB_SUCCESS, gts_source_.get_gts(MonotonicTs::current_time(), NULL, lease_gts,
+                                              receive_gts_ts));
+    // generated locally, ahead of the local clock by the uncertainty and increasing
+    EXPECT_GE(lease_gts, now_ns + get_gts_clock_uncertainty_ns());
+    EXPECT_GE(lease_gts, last_gts);
+    EXPECT_LT(lease_gts, gts + get_gts_lease_time_us() * NS_PER_US);
+    last_gts = lease_gts;
+  }
+  EXPECT_EQ(0, rpc_.post_cnt_);
+  EXPECT_EQ(10, ATOMIC_LOAD(&gts_source_.gts_statistics_.get_gts_by_lease_cnt_));
+}
+
+TEST_F(TestObGtsLease, lease_expire)
+{
+  GCONF._gts_lease_time.set_value("10ms");
+  // the lease is counted from the time the request was sent
+  int64_t gts = 0;
+  receive_gts(MonotonicTs(MonotonicTs::current_time().mts_ - 20 * 1000), gts);
+  int64_t new_gts = 0;
+  MonotonicTs receive_gts_ts;
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(MonotonicTs::current_time(), NULL, new_gts, receive_gts_ts));
+  EXPECT_EQ(1, rpc_.post_cnt_);
+
+  // a fresh lease is granted by the next response and expires after the lease time
+  receive_gts(MonotonicTs::current_time(), gts);
+  ob_usleep(1000);
+  EXPECT_EQ(OB_SUCCESS, gts_source_.get_gts(MonotonicTs::current_time(), NULL, new_gts, receive_gts_ts));
+  ob_usleep(20 * 1000);
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(MonotonicTs::current_time(), NULL, new_gts, receive_gts_ts));
+  EXPECT_EQ(2, rpc_.post_cnt_);
+  EXPECT_EQ(1, ATOMIC_LOAD(&gts_source_.gts_statistics_.get_gts_by_lease_cnt_));
+}
+
+TEST_F(TestObGtsLease, lease_gts_end)
+{
+  GCONF._gts_lease_time.set_value("1s");
+  // the lease of a late response ends before the local clock catches up
+  bool update = false;
+  const MonotonicTs srr = MonotonicTs::current_time();
+  const int64_t gts = ObTimeUtility::current_time_ns() - 10 * 1000 * NS_PER_US;
+  ASSERT_EQ(OB_SUCCESS, gts_source_.update_gts(srr, gts, gts + 1000 * NS_PER_US, srr, update));
+  ob_usleep(1000);
+  int64_t new_gts = 0;
+  MonotonicTs receive_gts_ts;
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(MonotonicTs::current_time(), NULL, new_gts, receive_gts_ts));
+  EXPECT_EQ(1, rpc_.post_cnt_);
+}
+
+TEST_F(TestObGtsLease, uncertainty_wait)
+{
+  GCONF._gts_lease_time.set_value("1s");
+  GCONF._gts_clock_uncertainty.set_value("100ms");
+  const int64_t uncertainty_ns = get_gts_clock_uncertainty_ns();
+  ASSERT_EQ(100 * 1000 * NS_PER_US, uncertainty_ns);
+  int64_t gts = 0;
+  receive_gts(MonotonicTs::current_time(), gts);
+
+  // an old version has elapsed already
+  EXPECT_EQ(OB_SUCCESS, gts_source_.wait_gts_elapse(gts - 2 * uncertainty_ns));
+  // the cached gts covers the version, but the local clock has not exceeded it by the uncertainty
+  EXPECT_EQ(OB_EAGAIN, gts_source_.wait_gts_elapse(gts));
+  int ret = OB_EAGAIN;
+  while (OB_EAGAIN == ret) {
+    ob_usleep(10 * 1000);
+    ret = gts_source_.wait_gts_elapse(gts);
+  }
+  EXPECT_EQ(OB_SUCCESS, ret);
+  EXPECT_GE(ObTimeUtility::current_time_ns() - uncertainty_ns, gts);
+
+  // without lease the version elapses as soon as the cached gts covers it
+  GCONF._gts_lease_time.set_value("0ms");
+  receive_gts(MonotonicTs::current_time(), gts);
+  EXPECT_EQ(OB_SUCCESS, gts_source_.wait_gts_elapse(gts));
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_lease.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
@@ -15,6 +15,9 @@
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "storage/tx/ob_trans_define.h"
+#include "lib/objectpool/ob_server_object_pool.h"
+#include <thread>
+#include <vector>
 
 namespace oceanbase
 {
@@ -56,6 +59,7 @@ public:
   }
   bool contain(const ObTransID &trans_id) { return trans_id_ == trans_id; }
   const ObTransID &get_trans_id() const { return trans_id_; }
+  void reset() { trans_id_.reset(); }
   TO_STRING_KV(K_(trans_id));
 private:
   ObTransID trans_id_;
@@ -76,7 +80,23 @@ public:
   }
 };
 
+class ObTransTestValuePoolAlloc
+{
+public:
+  ObTransTestValue *alloc_value() {
+    // the same as the participant context
+    return sop_borrow(ObTransTestValue);
+  }
+  void free_value(ObTransTestValue * val) {
+    if (NULL != val) {
+      sop_return(ObTransTestValue, val);
+    }
+  }
+};
+
 typedef ObTransHashMap<ObTransID, ObTransTestValue, ObTransTestValueAlloc, common::SpinRWLock> TestHashMap;
+typedef ObTransHashMap<ObTransID, ObTransTestValue, ObTransTestValuePoolAlloc,
+                       common::SpinRWLock, 1 << 14> TestPoolHashMap;
 
 class ForeachFunctor
 {
@@ -166,6 +186,69 @@ TEST_F(TestObTrans, hashmap_init_invalid)
   EXPECT_EQ(0, map.count());
 }
 
+// create, lookup and release contexts concurrently in the way of ObLSTxCtxMgr
+template <typename HashMap>
+void bench_ctx_map(const char *name, const int64_t thread_cnt)
+{
+  static const int64_t TX_CNT_PER_THREAD = 50000;
+  static const int64_t GET_CNT_PER_TX = 4;
+  HashMap map;
+  ASSERT_EQ(OB_SUCCESS, map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans")));
+  std::vector<std::thread> threads;
+  // gtest assertions are not used in the worker threads, the results are checked after join
+  std::vector<int> rets(thread_cnt, OB_SUCCESS);
+  const int64_t start_us = ObTimeUtility::current_time();
+  for (int64_t t = 0; t < thread_cnt; ++t) {
+    threads.push_back(std::thread([&map, &rets, t]() {
+      int ret = OB_SUCCESS;
+      for (int64_t i = 0; OB_SUCC(ret) && i < TX_CNT_PER_THREAD; ++i) {
+        const ObTransID tx_id(t * TX_CNT_PER_THREAD + i + 1);
+        ObTransTestValue *val = NULL;
+        ObTransTestValue *tmp = NULL;
+        if (OB_FAIL(map.alloc_value(val))) {
+        } else if (OB_FAIL(val->init(tx_id))) {
+          map.free_value(val);
+        } else if (OB_FAIL(map.insert_and_get(tx_id, val, NULL))) {
+          map.free_value(val);
+        } else {
+          map.revert(val);
+          for (int64_t j = 0; OB_SUCC(ret) && j < GET_CNT_PER_TX; ++j) {
+            if (OB_SUCC(map.get(tx_id, tmp))) {
+              map.revert(tmp);
+            }
+          }
+          if (OB_SUCC(ret)) {
+            ret = map.del(tx_id, val);
+          }
+        }
+      }
+      rets[t] = ret;
+    }));
+  }
+  for (int64_t t = 0; t < thread_cnt; ++t) {
+    threads[t].join();
+  }
+  for (int64_t t = 0; t < thread_cnt; ++t) {
+    EXPECT_EQ(OB_SUCCESS, rets[t]);
+  }
+  const int64_t used_us = max(ObTimeUtility::current_time() - start_us, 1L);
+  const int64_t tx_cnt = thread_cnt * TX_CNT_PER_THREAD;
+  TRANS_LOG(INFO, "ctx map benchmark", K(name), K(thread_cnt), K(tx_cnt), K(used_us),
+            "tx_per_sec", tx_cnt * 1000000 / used_us,
+            "get_per_sec", tx_cnt * GET_CNT_PER_TX * 1000000 / used_us);
+  EXPECT_EQ(0, map.count());
+}
+
+TEST_F(TestObTrans, hashmap_concurrent_benchmark)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  const int64_t thread_cnts[] = {1, 4, 16};
+  for (int64_t i = 0; i < ARRAYSIZEOF(thread_cnts); ++i) {
+    bench_ctx_map<TestHashMap>("op_alloc", thread_cnts[i]);
+    bench_ctx_map<TestPoolHashMap>("object_pool", thread_cnts[i]);
+  }
+}
+
 }//end of unittest
 }//end of oceanbase
 
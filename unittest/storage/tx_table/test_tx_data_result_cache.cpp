@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+
+#include "storage/tx_table/ob_tx_table_define.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace storage;
+
+namespace unittest
+{
+
+class TestTxDataResultCache : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    ObMemAttr attr(OB_SERVER_TENANT_ID, "TxDataCacheTest");
+    ASSERT_EQ(OB_SUCCESS, cache_.init(attr));
+  }
+  virtual void TearDown() override { cache_.destroy(); }
+
+  static void make_tx_data(const int64_t id, const int32_t state, ObTxData &tx_data)
+  {
+    tx_data.reset();
+    tx_data.tx_id_ = ObTransID(id);
+    tx_data.state_ = state;
+    tx_data.commit_version_ = 1000 + id;
+    tx_data.start_log_ts_ = 10 + id;
+    tx_data.end_log_ts_ = 20 + id;
+  }
+
+  ObTxDataResultCache cache_;
+};
+
+TEST_F(TestTxDataResultCache, put_and_get)
+{
+  ObTxData tx_data;
+  ObTxData res;
+  make_tx_data(1, ObTxData::COMMIT, tx_data);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(tx_data.tx_id_, res));
+  cache_.put(tx_data);
+  ASSERT_EQ(OB_SUCCESS, cache_.get(tx_data.tx_id_, res));
+  ASSERT_EQ(ObTxData::COMMIT, res.state_);
+  ASSERT_EQ(tx_data.commit_version_, res.commit_version_);
+  ASSERT_EQ(tx_data.start_log_ts_, res.start_log_ts_);
+  ASSERT_EQ(tx_data.end_log_ts_, res.end_log_ts_);
+  ASSERT_EQ(1, cache_.get_hit_cnt());
+  ASSERT_EQ(1, cache_.get_miss_cnt());
+
+  // a different tx mapped to the same slot replaces the old one
+  for (int64_t id = 2; id < 2 + 4 * ObTxDataResultCache::SLOT_CNT; id++) {
+    make_tx_data(id, ObTxData::ABORT, tx_data);
+    cache_.put(tx_data);
+    ASSERT_EQ(OB_SUCCESS, cache_.get(tx_data.tx_id_, res));
+    ASSERT_EQ(ObTxData::ABORT, res.state_);
+  }
+
+  cache_.clear();
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(tx_data.tx_id_, res));
+}
+
+TEST_F(TestTxDataResultCache, skip_undecided_tx)
+{
+  ObTxData tx_data;
+  ObTxData res;
+  make_tx_data(1, ObTxData::RUNNING, tx_data);
+  cache_.put(tx_data);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(tx_data.tx_id_, res));
+
+  make_tx_data(2, ObTxData::ELR_COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(tx_data.tx_id_, res));
+
+  // tx with undo actions can not be described by the cache
+  ObUndoStatusNode node;
+  make_tx_data(3, ObTxData::COMMIT, tx_data);
+  tx_data.undo_status_list_.head_ = &node;
+  ASSERT_FALSE(ObTxDataResultCache::can_cache(tx_data));
+  cache_.put(tx_data);
+  tx_data.undo_status_list_.head_ = nullptr;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(tx_data.tx_id_, res));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_tx_data_result_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_result_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}